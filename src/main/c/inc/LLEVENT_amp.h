@@ -0,0 +1,171 @@
+/*
+ * C
+ *
+ * Copyright 2026 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+#ifndef  LLEVENT_AMP_H
+#define  LLEVENT_AMP_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @file
+ * @brief LLEVENT bridge of the events produced by another core into the event queue (see EVENT_AMP_BRIDGE_SUPPORT).
+ * @author MicroEJ Developer Team
+ * @version 1.0.1
+ *
+ * The events are written by a single producer core into a single-producer single-consumer ring placed in a memory
+ * shared by both cores, then moved into the event queue by the doorbell interrupt handler of the core running the
+ * virtual machine:
+ * 	- the VM core calls LLEVENT_AMP_initialize() before starting the producer core,
+ * 	- the producer core offers its events with LLEVENT_AMP_offer_event() and LLEVENT_AMP_offer_extended_event(), then
+ * 	  triggers the doorbell interrupt of the VM core (e.g. an IPCC channel or a hardware semaphore release),
+ * 	- the doorbell interrupt handler of the VM core calls LLEVENT_AMP_doorbell_handler().
+ *
+ * This header and LLEVENT_amp_ring.c do not depend on ThreadX or on the MicroEJ Architecture, so that they can be
+ * built on the producer core. Both cores must be built with the same LLEVENT_AMP_RING_WORDS. The same ring is used by
+ * the producer lanes of the VM core (see EVENT_PRODUCER_LANE_COUNT).
+ *
+ * The ring must be placed in a memory that is not cached by the producer core nor by the VM core (or whose cache is
+ * kept coherent), at the same physical address for both cores, e.g. with a dedicated linker section.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+
+/**
+ * Number of 32-bit words of the ring (power of 2). A simple event takes 2 words, an extended event 2 words plus its
+ * data length rounded up to a multiple of 4 bytes.
+ */
+#define LLEVENT_AMP_RING_WORDS (256u)
+
+/**
+ * Maximum data length in bytes of an extended event offered through the ring: an event takes at most half of the ring,
+ * so that it always fits in the empty ring with the padding of the end of the ring.
+ */
+#define LLEVENT_AMP_MAX_DATA_LENGTH (((LLEVENT_AMP_RING_WORDS / 2u) - 2u) * 4u)
+
+/**
+ * The ring shared by a producer (the producer core) and a consumer (the VM core).
+ *
+ * The indexes are free-running: the word of an index is at index % LLEVENT_AMP_RING_WORDS.
+ * 	- write_index = the index of the next word written, only written by the producer.
+ * 	- read_index = the index of the next word read, only written by the consumer.
+ * 	- dropped_events = the number of events of the ring dropped by the consumer because they are corrupted, have
+ * 	  invalid arguments or did not fit in the event queue, only written by the consumer.
+ * 	- words = the events: a header word (the type, with bit 31 set for an extended event), a word with the data (or
+ * 	  the data length) and the data of an extended event. An event never wraps around the end of the ring: the unused
+ * 	  words at the end of the ring start with LLEVENT_AMP_PADDING.
+ */
+typedef struct {
+	_Atomic uint32_t write_index;
+	_Atomic uint32_t read_index;
+	uint32_t dropped_events;
+	uint32_t words[LLEVENT_AMP_RING_WORDS];
+} LLEVENT_amp_ring_t;
+
+/** The header word of the unused words at the end of the ring. */
+#define LLEVENT_AMP_PADDING       ((uint32_t)0xFFFFFFFF)
+/** The flag of the header word of an extended event. */
+#define LLEVENT_AMP_EXTENDED_FLAG ((uint32_t)0x1 << (uint32_t)31)
+
+/**
+ * An event read from the ring by LLEVENT_AMP_peek_event().
+ * 	- type = the type of the event.
+ * 	- extended = true for an extended event.
+ * 	- data = the data of a simple event, the data length of an extended event.
+ * 	- extended_data = the data of an extended event, in the ring.
+ * 	- words = the number of words of the ring taken by the event.
+ */
+typedef struct {
+	int32_t type;
+	bool extended;
+	uint32_t data;
+	void* extended_data;
+	uint32_t words;
+} LLEVENT_amp_event_t;
+
+// -----------------------------------------------------------------------------
+// Ring (LLEVENT_amp_ring.c)
+// -----------------------------------------------------------------------------
+
+/**
+ * Empties the ring, before the producer starts to use it.
+ *
+ * @param ring the ring.
+ */
+void LLEVENT_AMP_initialize(LLEVENT_amp_ring_t* ring);
+
+/**
+ * Writes an event into the ring. The arguments are checked by the consumer.
+ *
+ * Must be called by a single producer at a time. The VM core is not notified: the caller triggers the doorbell
+ * interrupt once, after one or several events.
+ *
+ * @param ring the ring.
+ * @param type the type of the event.
+ * @param data the data of the event.
+ * @return true if the event has been written, false if the ring is full.
+ */
+bool LLEVENT_AMP_offer_event(LLEVENT_amp_ring_t* ring, int32_t type, int32_t data);
+
+/**
+ * Writes an extended event into the ring: the data is copied into the ring and copied again into the payload buffer
+ * of its queue by the consumer. The arguments are checked by the consumer.
+ *
+ * Must be called by a single producer at a time. The VM core is not notified: the caller triggers the doorbell
+ * interrupt once, after one or several events.
+ *
+ * @param ring the ring.
+ * @param type the type of the event.
+ * @param data the data of the event.
+ * @param data_length the number of bytes of data, LLEVENT_AMP_MAX_DATA_LENGTH at most.
+ * @return true if the event has been written, false if the ring is full or the data too large.
+ */
+bool LLEVENT_AMP_offer_extended_event(LLEVENT_amp_ring_t* ring, int32_t type, const void* data, uint32_t data_length);
+
+/**
+ * Gets the first event of the ring, without removing it. Must be called by a single consumer at a time.
+ *
+ * An event whose length exceeds the written words is corrupted: it is dropped with all the events written so far and
+ * counted in dropped_events.
+ *
+ * @param ring the ring.
+ * @param event the destination of the event, valid until it is released.
+ * @return true if an event is available, false if the ring is empty.
+ */
+bool LLEVENT_AMP_peek_event(LLEVENT_amp_ring_t* ring, LLEVENT_amp_event_t* event);
+
+/**
+ * Removes the event returned by LLEVENT_AMP_peek_event() from the ring, its words can be written again.
+ *
+ * @param ring the ring.
+ * @param event the event.
+ */
+void LLEVENT_AMP_release_event(LLEVENT_amp_ring_t* ring, const LLEVENT_amp_event_t* event);
+
+// -----------------------------------------------------------------------------
+// VM core (LLEVENT_amp.c)
+// -----------------------------------------------------------------------------
+
+/**
+ * Moves the events of the ring into the event queue with LLEVENT_offerEventFromISR() and
+ * LLEVENT_offerExtendedEventFromISR(). Must be called from the doorbell interrupt handler.
+ *
+ * At most the events of a full ring are moved per call, the events written in the meantime are moved by the next call.
+ * The events that cannot be offered (invalid arguments or full queue) are counted in dropped_events.
+ *
+ * @param ring the ring.
+ */
+void LLEVENT_AMP_doorbell_handler(LLEVENT_amp_ring_t* ring);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // LLEVENT_AMP_H
@@ -0,0 +1,125 @@
+/*
+ * C
+ *
+ * Copyright 2026 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+#ifndef  LLEVENT_FRAMING_H
+#define  LLEVENT_FRAMING_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @file
+ * @brief LLEVENT layout of the 32-bit events and sizing of the data of the extended events.
+ * @author MicroEJ Developer Team
+ * @version 1.0.1
+ *
+ * An event is a 32-bit word:
+ * 	- bit 31 = 1 for an extended event, 0 for a simple event.
+ * 	- the next EVENT_TYPE_BITS bits = the type of the event.
+ * 	- the low EVENT_DATA_BITS bits = the data of a simple event, or the number of bytes of data of an extended event.
+ * The data of an extended event is stored in 32-bit words, its length rounded up to a multiple of 4 bytes.
+ *
+ * Only integer operations are used, the sizing of the data does not require a FPU nor a floating-point library.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "sni.h"
+#include "event_configuration.h"
+#include "LLEVENT.h"
+#include "LLEVENT_impl.h"
+
+#if (EVENT_TYPE_BITS < 1) || (EVENT_DATA_BITS < 1) || ((EVENT_TYPE_BITS + EVENT_DATA_BITS) > 31)
+#error "EVENT_TYPE_BITS and EVENT_DATA_BITS must fit in the 31 low bits of an event."
+#endif
+
+/** The flag of an extended event. */
+#define LLEVENT_FRAMING_EXTENDED_FLAG    ((uint32_t)0x1 << (uint32_t)31)
+/** The shift of the type in an event. */
+#define LLEVENT_FRAMING_TYPE_SHIFT       ((uint32_t)EVENT_DATA_BITS)
+/** The number of event types. */
+#define LLEVENT_FRAMING_MAX_TYPE_ID      ((uint32_t)0x1 << (uint32_t)EVENT_TYPE_BITS)
+/** The mask of the type, once shifted. */
+#define LLEVENT_FRAMING_TYPE_MASK        (LLEVENT_FRAMING_MAX_TYPE_ID - 1u)
+/** The mask of the data of a simple event or of the data length of an extended event. */
+#define LLEVENT_FRAMING_DATA_MASK        (((uint32_t)0x1 << (uint32_t)EVENT_DATA_BITS) - 1u)
+
+/**
+ * Gets a simple event.
+ *
+ * @param type the type of the event, lower than LLEVENT_FRAMING_MAX_TYPE_ID.
+ * @param data the data of the event, in LLEVENT_FRAMING_DATA_MASK.
+ */
+static inline uint32_t LLEVENT_FRAMING_simple_event(uint32_t type, uint32_t data) {
+	// Make sure that the first bit is 0 because it is not an extended event.
+	return ((type << LLEVENT_FRAMING_TYPE_SHIFT) | data) & ~LLEVENT_FRAMING_EXTENDED_FLAG;
+}
+
+/**
+ * Gets the first word of an extended event.
+ *
+ * @param type the type of the event, lower than LLEVENT_FRAMING_MAX_TYPE_ID.
+ * @param data_length the number of bytes of data, in LLEVENT_FRAMING_DATA_MASK.
+ */
+static inline uint32_t LLEVENT_FRAMING_extended_event(uint32_t type, uint32_t data_length) {
+	return LLEVENT_FRAMING_EXTENDED_FLAG | (type << LLEVENT_FRAMING_TYPE_SHIFT) | data_length;
+}
+
+/**
+ * Returns true if an event is an extended event.
+ */
+static inline bool LLEVENT_FRAMING_is_extended(uint32_t event) {
+	return (event & LLEVENT_FRAMING_EXTENDED_FLAG) != 0u;
+}
+
+/**
+ * Gets the type of an event.
+ */
+static inline uint32_t LLEVENT_FRAMING_get_type(uint32_t event) {
+	return (event >> LLEVENT_FRAMING_TYPE_SHIFT) & LLEVENT_FRAMING_TYPE_MASK;
+}
+
+/**
+ * Gets the data of a simple event or the number of bytes of data of an extended event.
+ */
+static inline uint32_t LLEVENT_FRAMING_get_data(uint32_t event) {
+	return event & LLEVENT_FRAMING_DATA_MASK;
+}
+
+/**
+ * Gets the number of 32-bit words used to store data_length bytes of extended data (rounded up).
+ */
+static inline uint32_t LLEVENT_FRAMING_get_payload_words(uint32_t data_length) {
+	return (data_length + (uint32_t)sizeof(uint32_t) - 1u) / (uint32_t)sizeof(uint32_t);
+}
+
+/**
+ * Defines a function offering the extended events of a fixed type whose data is a value of a fixed C type, e.g.
+ * LLEVENT_FRAMING_TYPED_OFFER(offer_touch, 12, touch_event_t) defines
+ * int32_t offer_touch(const touch_event_t* value).
+ *
+ * The type of the event and the data length are checked at compile time, the defined function offers the event
+ * without checking its arguments. It returns NO_ERR on success or ERR_FIFO_FULL if the queue is full.
+ *
+ * @param name the name of the function.
+ * @param event_type the type of the events, a constant lower than LLEVENT_FRAMING_MAX_TYPE_ID.
+ * @param value_type the C type of the data of the events, a struct or an array of N ints for instance.
+ */
+#define LLEVENT_FRAMING_TYPED_OFFER(name, event_type, value_type) \
+	typedef char name##_type_check[((uint32_t)(event_type) < LLEVENT_FRAMING_MAX_TYPE_ID) ? 1 : -1]; \
+	typedef char name##_length_check[(sizeof(value_type) <= LLEVENT_FRAMING_DATA_MASK) ? 1 : -1]; \
+	static inline int32_t name(const value_type* value) { \
+		return LLEVENT_IMPL_offer_extended_event((uint32_t)(event_type), value, (uint32_t)sizeof(value_type)) ? \
+		       NO_ERR : ERR_FIFO_FULL; \
+	}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // LLEVENT_FRAMING_H
@@ -0,0 +1,99 @@
+/*
+ * C
+ *
+ * Copyright 2026 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+#ifndef  LLEVENT_REPLAY_H
+#define  LLEVENT_REPLAY_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @file
+ * @brief LLEVENT replay log of the ThreadX implementation (see EVENT_REPLAY_LOG_SUPPORT).
+ * @author MicroEJ Developer Team
+ * @version 1.0.1
+ *
+ * Each event accepted by a queue (including a coalesced event) is recorded into a RAM ring by its producer, without
+ * waiting: the space of its record is reserved with a short interrupt lockout, then the record is copied with the
+ * interrupts enabled. An event recorded while the ring is full is dropped and counted. The ring is written out in
+ * batches by LLEVENT_REPLAY_flush(), called periodically by a low priority thread of the application, e.g. to a file
+ * or a UART. The records being copied are flushed by the next call.
+ *
+ * The events are recorded once out of the critical section of the queues, so that the copy of the records does not
+ * delay the other producers: the records of events offered at the same time by several producers may be out of the
+ * order of their queue. A mapped extended event is recorded within the critical section, and the extended events of
+ * the lock-free queue before they are committed, since the Java thread may release the data of a mapped event as soon
+ * as it is queued.
+ *
+ * The log is a sequence of records of 32-bit words, in the byte order of the device:
+ * 	- the first word of the event: the type and the data of a simple event, or the type, the extended flag and the
+ * 	  data length of an extended event (see LLEVENT_framing.h),
+ * 	- the EVENT_TIMESTAMP() of the event,
+ * 	- the data of an extended event, its data length rounded up to a multiple of 4 bytes (the padding bytes are 0).
+ *
+ * A captured log is offered again by LLEVENT_REPLAY_replay(), to reproduce a session or to benchmark the throughput of
+ * the Java listeners with a real-world event stream.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "sni.h"
+#include "event_configuration.h"
+
+#if EVENT_REPLAY_LOG_SUPPORT == 1
+
+/**
+ * Records an event accepted by a queue. Called by the producers, from a thread or an interrupt handler.
+ *
+ * @param event_message the first word of the event.
+ * @param data the data of an extended event, NULL for a simple event.
+ */
+void LLEVENT_REPLAY_record(uint32_t event_message, const void* data);
+
+#define LLEVENT_REPLAY_RECORD(event_message, data) LLEVENT_REPLAY_record((event_message), (data))
+
+/**
+ * Writes the records of the ring with EVENT_REPLAY_LOG_WRITE(), in at most two calls, and frees their space. Must be
+ * called by a single thread at a time. The producers are not blocked while the records are written.
+ *
+ * @return the number of bytes written.
+ */
+uint32_t LLEVENT_REPLAY_flush(void);
+
+/**
+ * Gets the number of events dropped from the log because the ring was full.
+ */
+uint32_t LLEVENT_REPLAY_get_dropped_events(void);
+
+/**
+ * Offers the events of a captured log again with LLEVENT_offerEvent() and LLEVENT_offerExtendedEvent(). Must be
+ * called from a ThreadX thread, of a lower priority than the Java threads for a throughput benchmark.
+ *
+ * When an event does not fit in its queue, the calling thread sleeps for a tick and offers it again, up to 1000 times
+ * before the event is skipped.
+ *
+ * @param log the log, whose records are aligned on 4 bytes.
+ * @param length the number of bytes of the log.
+ * @param original_timing true to offer each event at its original time relative to the first event (converted with
+ * EVENT_REPLAY_TICKS()), false to offer the events as fast as possible.
+ * @return the number of events offered, or -1 if the log ends with an incomplete record. The events skipped or
+ * rejected with ERR_WRONG_ARGS are not counted.
+ */
+int32_t LLEVENT_REPLAY_replay(const void* log, uint32_t length, bool original_timing);
+
+#else
+
+#define LLEVENT_REPLAY_RECORD(event_message, data) ((void)0)
+
+#endif // EVENT_REPLAY_LOG_SUPPORT == 1
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // LLEVENT_REPLAY_H
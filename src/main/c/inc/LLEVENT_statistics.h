@@ -0,0 +1,127 @@
+/*
+ * C
+ *
+ * Copyright 2026 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+#ifndef  LLEVENT_STATISTICS_H
+#define  LLEVENT_STATISTICS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @file
+ * @brief LLEVENT instrumentation of the ThreadX implementation (see EVENT_INSTRUMENTATION).
+ * @author MicroEJ Developer Team
+ * @version 1.0.1
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "sni.h"
+#include "event_configuration.h"
+
+#if EVENT_INSTRUMENTATION == 1
+
+/**
+ * The statistics returned by LLEVENT_IMPL_get_statistic(). The meaning of the index depends on the statistic.
+ */
+/** Number of events of a type successfully offered, including the coalesced ones. Index: the event type. */
+#define LLEVENT_STATISTIC_OFFERED              (0)
+/** Number of events of a type not offered because the queue was full. Index: the event type. */
+#define LLEVENT_STATISTIC_DROPPED              (1)
+/**
+ * Maximum number of events in a queue (maximum number of words with the lock-free backend).
+ * Index: the queue priority.
+ */
+#define LLEVENT_STATISTIC_QUEUE_HIGH_WATER     (2)
+/**
+ * Maximum number of words used in the payload buffer of a queue (ThreadX queue backend only).
+ * Index: the queue priority.
+ */
+#define LLEVENT_STATISTIC_PAYLOAD_HIGH_WATER   (3)
+/**
+ * Number of times a producer had to wait for the mutex (or had to retry its reservation with the lock-free backend).
+ * Index: ignored.
+ */
+#define LLEVENT_STATISTIC_CONTENTIONS          (4)
+/** Total time spent by the producers waiting for the mutex, in EVENT_TIMESTAMP() units. Index: ignored. */
+#define LLEVENT_STATISTIC_CONTENTION_TIME      (5)
+/**
+ * Number of events whose enqueue-to-dequeue latency, in EVENT_TIMESTAMP() units, is in [2^(index-1), 2^index[
+ * (index 0 counts the null latencies, the last index counts all the latencies above).
+ * Index: the histogram bin, from 0 to EVENT_LATENCY_HISTOGRAM_BINS - 1.
+ */
+#define LLEVENT_STATISTIC_LATENCY              (6)
+/**
+ * Number of events of a type discarded because the type is disabled (see LLEVENT_setTypeEnabled()).
+ * Index: the event type.
+ */
+#define LLEVENT_STATISTIC_FILTERED             (7)
+
+/**
+ * Gets a statistic of the event queue. Can be bound to a Java native method.
+ *
+ * @param statistic the statistic, one of the LLEVENT_STATISTIC_* values.
+ * @param index the index of the value (see the statistic).
+ * @return the value, 0 if the statistic or the index is invalid.
+ */
+jint LLEVENT_IMPL_get_statistic(jint statistic, jint index);
+
+/**
+ * Resets all the statistics of the event queue. Can be bound to a Java native method.
+ */
+void LLEVENT_IMPL_reset_statistics(void);
+
+/**
+ * Records an offer of an event.
+ * Called in the critical section protecting the event queues (any context with the lock-free backend).
+ *
+ * @param type the type of the event.
+ * @param offered true if the event has been offered, false if it has been dropped.
+ */
+void LLEVENT_STATISTICS_record_offer(uint32_t type, bool offered);
+
+/**
+ * Records an event discarded because its type is disabled.
+ * Called in the critical section protecting the event queues (any context with the lock-free backend).
+ *
+ * @param type the type of the event.
+ */
+void LLEVENT_STATISTICS_record_filtered(uint32_t type);
+
+/**
+ * Records the usage of a queue after an event has been sent.
+ * Called in the critical section protecting the event queues (any context with the lock-free backend).
+ *
+ * @param priority the priority of the queue.
+ * @param events the number of events (words with the lock-free backend) in the queue.
+ * @param payload_words the number of words used in the payload buffer of the queue.
+ */
+void LLEVENT_STATISTICS_record_queue_usage(uint32_t priority, uint32_t events, uint32_t payload_words);
+
+/**
+ * Records a contention on the critical section protecting the event queues.
+ * Called in the critical section protecting the event queues (any context with the lock-free backend).
+ *
+ * @param wait_time the time spent waiting, in EVENT_TIMESTAMP() units.
+ */
+void LLEVENT_STATISTICS_record_contention(uint32_t wait_time);
+
+/**
+ * Records the enqueue-to-dequeue latency of an event. Called by the Java thread.
+ *
+ * @param latency the latency, in EVENT_TIMESTAMP() units.
+ */
+void LLEVENT_STATISTICS_record_latency(uint32_t latency);
+
+#endif // EVENT_INSTRUMENTATION == 1
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // LLEVENT_STATISTICS_H
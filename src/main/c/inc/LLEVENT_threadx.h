@@ -0,0 +1,663 @@
+/*
+ * C
+ *
+ * Copyright 2026 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+#ifndef  LLEVENT_THREADX_H
+#define  LLEVENT_THREADX_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @file
+ * @brief LLEVENT extensions specific to the ThreadX implementation.
+ * @author MicroEJ Developer Team
+ * @version 1.0.1
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "sni.h"
+#include "event_configuration.h"
+
+/**
+ * Function called once the data of a mapped extended event has been read (see LLEVENT_offerMappedExtendedEvent()).
+ *
+ * @param data the data of the event.
+ * @param arg the argument given with the event.
+ */
+typedef void (*LLEVENT_release_callback_t)(const void* data, void* arg);
+
+/**
+ * Maximum number of events of a batch offered with LLEVENT_offerEvents().
+ */
+#define LLEVENT_BATCH_MAX_EVENTS (32)
+
+/**
+ * An event of a batch offered with LLEVENT_offerEvents().
+ * 	- type = the type of the event.
+ * 	- data = the data of a simple event, or the number of bytes of data of an extended event.
+ * 	- extended_data = the data of an extended event, copied at the offer, NULL for a simple event.
+ */
+typedef struct {
+	int32_t type;
+	int32_t data;
+	const void* extended_data;
+} LLEVENT_batch_event_t;
+
+/**
+ * Sets the priority of an event type. The events of this type are sent to the queue of this priority and
+ * LLEVENT_IMPL_wait_event() returns the events of the queues with a higher priority first.
+ *
+ * A type whose priority has never been set has the lowest priority (0).
+ *
+ * @param type the type of the event.
+ * @param priority the priority, between 0 (the lowest) and EVENT_QUEUE_COUNT - 1 (the highest).
+ * @return NO_ERR on success, ERR_WRONG_ARGS if the arguments are invalid.
+ */
+int32_t LLEVENT_setTypePriority(int32_t type, int32_t priority);
+
+/**
+ * Sets the priority of an event type. The arguments are not checked.
+ *
+ * @param type the type of the event.
+ * @param priority the priority, between 0 (the lowest) and EVENT_QUEUE_COUNT - 1 (the highest).
+ */
+void LLEVENT_IMPL_set_type_priority(uint32_t type, uint32_t priority);
+
+/**
+ * Gets the priority of an event type. The type is not checked.
+ *
+ * @param type the type of the event.
+ * @return the priority, between 0 (the lowest) and EVENT_QUEUE_COUNT - 1 (the highest).
+ */
+uint32_t LLEVENT_IMPL_get_type_priority(uint32_t type);
+
+#if EVENT_WAKEUP_BATCH_SIZE > 1
+
+/**
+ * Sets the urgency of an event type when the wakeups of the Java thread are batched (see EVENT_WAKEUP_BATCH_SIZE). An
+ * event of an urgent type resumes the waiting Java thread as soon as it is offered, with the deferrable events offered
+ * before it. The events of a deferrable type are buffered until EVENT_WAKEUP_BATCH_SIZE events have been offered or
+ * EVENT_WAKEUP_DELAY ticks after the first of them, so that a flood of background events does not wake the Java
+ * thread for each of them.
+ *
+ * All the types are deferrable by default. The events of the producer lanes and of the overflow ring resume the Java
+ * thread at once, whatever their type. A batch of events (see LLEVENT_offerEvents()) is urgent if one of its events is.
+ *
+ * @param type the type of the event.
+ * @param urgent true for an urgent type, false for a deferrable type (default).
+ * @return NO_ERR on success, ERR_WRONG_ARGS if the type is invalid.
+ */
+int32_t LLEVENT_setTypeUrgent(int32_t type, bool urgent);
+
+/**
+ * Sets the urgency of an event type. The arguments are not checked.
+ *
+ * @param type the type of the event.
+ * @param urgent true for an urgent type, false for a deferrable type.
+ */
+void LLEVENT_IMPL_set_type_urgent(uint32_t type, bool urgent);
+
+#endif // EVENT_WAKEUP_BATCH_SIZE > 1
+
+/**
+ * Offers a batch of simple and extended events to the queue as a single transaction, e.g. the press, moves and release
+ * of a touch gesture: either all the events are queued, consecutively and in order, or none of them is. The events of
+ * the batch cost a single critical section (a single reservation with the lock-free backend) and a single wakeup of
+ * the Java thread.
+ *
+ * All the events must have the same priority (see LLEVENT_setTypePriority()). The events of a disabled type are
+ * discarded (see LLEVENT_setTypeEnabled()). The simple events of a coalesced type are rejected: they would not be
+ * coalesced with the events of their type already in the queue (see LLEVENT_setTypeCoalescing()).
+ *
+ * @param events the events of the batch.
+ * @param count the number of events, between 1 and LLEVENT_BATCH_MAX_EVENTS.
+ * @return NO_ERR on success, ERR_WRONG_ARGS if the arguments are invalid, the events have different priorities or a
+ * simple event has a coalesced type, ERR_FIFO_FULL if the queue does not have enough space for the whole batch.
+ */
+int32_t LLEVENT_offerEvents(const LLEVENT_batch_event_t* events, int32_t count);
+
+/**
+ * Offers a batch of events to the queue as a single transaction. The arguments are not checked.
+ *
+ * @param events the events of the batch, all of the same priority.
+ * @param count the number of events, between 1 and LLEVENT_BATCH_MAX_EVENTS.
+ * @return true if the events have been sent, false otherwise.
+ */
+bool LLEVENT_IMPL_offer_events(const LLEVENT_batch_event_t* events, uint32_t count);
+
+#if EVENT_COALESCING_SUPPORT == 1
+
+/**
+ * Enables or disables the coalescing of the events of a type. When enabled, a simple event replaces the previous
+ * event of the same type that is still in the queue instead of taking a new place: the event keeps its place in the
+ * queue and the newest data is returned. The extended events are never coalesced.
+ *
+ * The coalescing of a type should be changed while no event of this type is in the queue.
+ *
+ * @param type the type of the event.
+ * @param coalescing true to enable the coalescing, false to disable it (default).
+ * @return NO_ERR on success, ERR_WRONG_ARGS if the type is invalid.
+ */
+int32_t LLEVENT_setTypeCoalescing(int32_t type, bool coalescing);
+
+/**
+ * Enables or disables the coalescing of the events of a type. The arguments are not checked.
+ *
+ * @param type the type of the event.
+ * @param coalescing true to enable the coalescing, false to disable it.
+ */
+void LLEVENT_IMPL_set_type_coalescing(uint32_t type, bool coalescing);
+
+/**
+ * Checks whether the events of a type are coalesced. The type is not checked.
+ *
+ * @param type the type of the event.
+ * @return true if the simple events of the type are coalesced, false otherwise.
+ */
+bool LLEVENT_IMPL_is_type_coalescing(uint32_t type);
+
+#endif // EVENT_COALESCING_SUPPORT == 1
+
+#if EVENT_TYPE_FILTER_SUPPORT == 1
+
+/**
+ * Enables or disables the events of a type, e.g. from the Java application when the screen listening to them is shown
+ * or hidden. The events of a disabled type are discarded by the offer functions, which return a success, before
+ * taking a place in the queue. The data of a discarded mapped extended event is released at once. The events of the
+ * type already in the queue are still dispatched.
+ *
+ * All the types are enabled by default. Can be bound to a Java native method.
+ *
+ * @param type the type of the event.
+ * @param enabled true to enable the events of the type, false to discard them.
+ * @return NO_ERR on success, ERR_WRONG_ARGS if the type is invalid.
+ */
+int32_t LLEVENT_setTypeEnabled(int32_t type, bool enabled);
+
+/**
+ * Enables or disables the events of a type. The arguments are not checked.
+ *
+ * @param type the type of the event.
+ * @param enabled true to enable the events of the type, false to discard them.
+ */
+void LLEVENT_IMPL_set_type_enabled(uint32_t type, bool enabled);
+
+#endif // EVENT_TYPE_FILTER_SUPPORT == 1
+
+#if EVENT_OVERFLOW_POLICY_SUPPORT == 1
+
+/** Overflow policy: an event offered while its queue is full is rejected with ERR_FIFO_FULL (default). */
+#define LLEVENT_OVERFLOW_REJECT      (0)
+/**
+ * Overflow policy: an event offered while its queue is full is spilled into the overflow ring, then the oldest event
+ * of its queue is discarded to make room for it when the Java thread moves it into the queue.
+ */
+#define LLEVENT_OVERFLOW_DROP_OLDEST (1)
+/**
+ * Overflow policy: an event offered while its queue is full is spilled into the overflow ring and moved into its queue
+ * by the Java thread once space is available.
+ */
+#define LLEVENT_OVERFLOW_SPILL       (2)
+
+/**
+ * Sets the policy applied to the events of a type offered while their queue is full, so that a burst of events
+ * degrades gracefully instead of being rejected.
+ *
+ * With the LLEVENT_OVERFLOW_SPILL and LLEVENT_OVERFLOW_DROP_OLDEST policies, the event is copied into the overflow ring
+ * (LLEVENT_AMP_RING_WORDS words shared by all the types, see LLEVENT_amp.h) and the offer succeeds. The Java thread
+ * moves the events of the ring into their queues in order before it checks the queues, the event at the head of the
+ * ring blocking the following ones until it fits in its queue. An event offered while the ring is not empty is spilled
+ * too, so that it does not overtake the spilled events. With LLEVENT_OVERFLOW_DROP_OLDEST, the oldest event of the
+ * queue is discarded, whatever its type, when the spilled event does not fit in it, and the oldest events of the ring
+ * are discarded when the ring is full, as long as they have this policy too: the newest events are kept, as many as the
+ * ring holds when the queue holds more. The offer is rejected with ERR_FIFO_FULL when the ring is full of events of
+ * other policies, or when the data is larger than LLEVENT_AMP_MAX_DATA_LENGTH.
+ *
+ * The data of a spilled mapped extended event is copied into the ring and given back to its producer before the offer
+ * returns. The offers with a timeout (see EVENT_BLOCKING_OFFER_SUPPORT) apply the policy too: they only wait for space
+ * when the ring is full. The batches are always rejected when their queue is full and the events of the producer lanes
+ * stay in their lane. The offer time of a spilled event (see EVENT_TIMESTAMP_SUPPORT) is the time it is moved into its
+ * queue.
+ *
+ * @param type the type of the event.
+ * @param policy one of the LLEVENT_OVERFLOW_* policies.
+ * @return NO_ERR on success, ERR_WRONG_ARGS if the arguments are invalid.
+ */
+int32_t LLEVENT_setTypeOverflowPolicy(int32_t type, int32_t policy);
+
+/**
+ * Sets the overflow policy of an event type. The arguments are not checked.
+ *
+ * @param type the type of the event.
+ * @param policy one of the LLEVENT_OVERFLOW_* policies.
+ */
+void LLEVENT_IMPL_set_type_overflow_policy(uint32_t type, uint32_t policy);
+
+/**
+ * Gets the number of events of a type lost since the start: rejected because their queue (and the overflow ring) was
+ * full, or discarded from their queue by the LLEVENT_OVERFLOW_DROP_OLDEST policy. Can be bound to a Java native method.
+ *
+ * @param type the type of the event.
+ * @return the number of events lost, 0 if the type is invalid.
+ */
+jint LLEVENT_IMPL_get_type_dropped_events(jint type);
+
+#endif // EVENT_OVERFLOW_POLICY_SUPPORT == 1
+
+#if EVENT_DELTA_TYPE_COUNT > 0
+
+/**
+ * Sets whether the extended events of a type are delta-encoded, so that the periodic extended events that change only
+ * a few bytes between two offers take a few words of the payload buffer.
+ *
+ * The data of an extended event of a delta-encoded type is compared with the data of the previous extended event of
+ * the type sent to the queue: when both have the same length, only the runs of bytes that differ are stored in the
+ * payload buffer. The Java thread decodes the data when the Java listener starts to read it, then LLEVENT_IMPL_read()
+ * and the typed readers read the decoded data. The first extended event of the type, the events whose length differs
+ * from the previous one and the events whose runs would not be shorter than their data are stored as is. The extended
+ * events larger than EVENT_DELTA_MAX_DATA_LENGTH, the mapped extended events and the batches are always stored as is.
+ *
+ * The delta-encoded events of a type must be read in the order they have been offered: the priority of the type must
+ * not change while its extended events are queued. An event read out of order does not match its reference: it has no
+ * data available, the reads of the Java listener throw an IOException, and so do the reads of the next events of the
+ * type until one is stored as is. The type keeps its references once the delta encoding is disabled, the next
+ * extended event of the type is stored as is when it is enabled again.
+ *
+ * @param type the type of the event.
+ * @param encoding true to delta-encode the extended events of this type, false to store them as is.
+ * @return NO_ERR on success, ERR_WRONG_ARGS if the type is invalid, ERR_FIFO_FULL if EVENT_DELTA_TYPE_COUNT types
+ * already are delta-encoded.
+ */
+int32_t LLEVENT_setTypeDeltaEncoding(int32_t type, bool encoding);
+
+/**
+ * Sets whether the extended events of a type are delta-encoded. The type is not checked.
+ *
+ * @param type the type of the event.
+ * @param encoding true to delta-encode the extended events of this type, false to store them as is.
+ * @return true on success, false if EVENT_DELTA_TYPE_COUNT other types already are delta-encoded.
+ */
+bool LLEVENT_IMPL_set_type_delta_encoding(uint32_t type, bool encoding);
+
+#endif // EVENT_DELTA_TYPE_COUNT > 0
+
+/**
+ * Waits for events from the queue and copies them into a Java int array, so that a batch of events is dispatched per
+ * native call.
+ *
+ * If no event is available, the Java thread is suspended until an event is offered. Otherwise, the available events
+ * are copied into the array, up to its length, in the order LLEVENT_IMPL_wait_event() would return them. An extended
+ * event is always the last event copied: its data must be read before the next call.
+ *
+ * @param events the Java int array to fill with the events.
+ * @return the number of events copied into the array, 0 if the thread could not be suspended.
+ */
+jint LLEVENT_IMPL_wait_events(jint* events);
+
+/**
+ * Waits for events from the queue until a timeout and copies them into a Java int array, so that the Java thread waits
+ * for the events and for its next timer with a single suspend, which lets the MCU stay longer in a low-power mode.
+ *
+ * Same as LLEVENT_IMPL_wait_events(), except that the Java thread is suspended for timeout milliseconds at most, with
+ * the deadline of SNI_suspendCurrentJavaThreadWithCallback(). If no event has been offered when it is resumed, 0 is
+ * returned: the timeout expired. 0 may also be returned before the timeout if the Java thread is resumed by an event
+ * already taken, the caller then waits again for the remaining time.
+ *
+ * @param events the Java int array to fill with the events.
+ * @param timeout the max time to wait in milliseconds, 0 to wait forever, negative to not wait.
+ * @return the number of events copied into the array, 0 if the timeout expired or if the thread could not be
+ * suspended.
+ */
+jint LLEVENT_IMPL_wait_events_with_timeout(jint* events, jlong timeout);
+
+#if EVENT_TIMESTAMP_SUPPORT == 1
+
+/**
+ * Waits for events from the queue and copies them into a Java int array, and their offer times into a second one.
+ *
+ * Same as LLEVENT_IMPL_wait_events(), up to the length of the shorter array: timestamps[i] is the offer time of
+ * events[i], captured with EVENT_TIMESTAMP(). A coalesced event keeps the offer time of the event it replaced.
+ *
+ * @param events the Java int array to fill with the events.
+ * @param timestamps the Java int array to fill with the offer times of the events.
+ * @return the number of events copied into the arrays, 0 if the thread could not be suspended.
+ */
+jint LLEVENT_IMPL_wait_timestamped_events(jint* events, jint* timestamps);
+
+/**
+ * Gets the offer time of the event returned last to the calling Java thread by LLEVENT_IMPL_wait_event() (or by the
+ * other wait functions, the last event of a batch), captured with EVENT_TIMESTAMP(). A coalesced event keeps the offer
+ * time of the event it replaced.
+ *
+ * The queueing delay of the event is LLEVENT_IMPL_get_current_timestamp() - LLEVENT_IMPL_get_event_timestamp() when the
+ * event is dispatched, modulo 2^32.
+ *
+ * @return the offer time of the event.
+ */
+jint LLEVENT_IMPL_get_event_timestamp(void);
+
+/**
+ * Gets the current time in the time base of the offer times of the events, EVENT_TIMESTAMP().
+ *
+ * @return the current time.
+ */
+jint LLEVENT_IMPL_get_current_timestamp(void);
+
+#endif // EVENT_TIMESTAMP_SUPPORT == 1
+
+#if EVENT_CONSUMER_COUNT > 1
+
+/**
+ * Waits for an event from the queues of a consumer (see EVENT_QUEUE_CONSUMERS), so that the events of separate queues
+ * are dispatched by separate Java threads.
+ *
+ * Same as LLEVENT_IMPL_wait_event() for the queues of the consumer. The data of an extended event is read by the Java
+ * thread that received it. A consumer must be waited on by a single Java thread at a time.
+ *
+ * @param consumer the index of the consumer, lower than EVENT_CONSUMER_COUNT.
+ * @return the event, 0 if the consumer is invalid: a NativeIOException is then thrown.
+ */
+jint LLEVENT_IMPL_wait_consumer_event(jint consumer);
+
+/**
+ * Waits for events from the queues of a consumer and copies them into a Java int array.
+ *
+ * Same as LLEVENT_IMPL_wait_events() for the queues of the consumer.
+ *
+ * @param consumer the index of the consumer, lower than EVENT_CONSUMER_COUNT.
+ * @param events the Java int array to fill with the events.
+ * @return the number of events copied into the array, 0 if the thread could not be suspended or if the consumer is
+ * invalid: a NativeIOException is then thrown.
+ */
+jint LLEVENT_IMPL_wait_consumer_events(jint consumer, jint* events);
+
+/**
+ * Waits for events from the queues of a consumer until a timeout and copies them into a Java int array.
+ *
+ * Same as LLEVENT_IMPL_wait_events_with_timeout() for the queues of the consumer.
+ *
+ * @param consumer the index of the consumer, lower than EVENT_CONSUMER_COUNT.
+ * @param events the Java int array to fill with the events.
+ * @param timeout the max time to wait in milliseconds, 0 to wait forever, negative to not wait.
+ * @return the number of events copied into the array, 0 if the timeout expired, if the thread could not be suspended
+ * or if the consumer is invalid: a NativeIOException is then thrown.
+ */
+jint LLEVENT_IMPL_wait_consumer_events_with_timeout(jint consumer, jint* events, jlong timeout);
+
+#endif // EVENT_CONSUMER_COUNT > 1
+
+#if EVENT_PRODUCER_LANE_COUNT > 0
+
+/**
+ * Registers a producer lane (see EVENT_PRODUCER_LANE_COUNT), to be used by a single producer thread.
+ *
+ * @return the index of the lane, ERR_FIFO_FULL if all the lanes are registered.
+ */
+int32_t LLEVENT_registerProducerLane(void);
+
+/**
+ * Offers an event to a producer lane: the event is written into the lane without any lock and moved into its queue by
+ * the Java thread before it checks the queues. The events of the lanes are moved one event of each lane in turn, the
+ * order of the events of a lane is kept. The offer time of the event (see EVENT_TIMESTAMP_SUPPORT) is the time it is
+ * moved into its queue.
+ *
+ * Must be called by the producer thread that registered the lane, not from an interrupt handler. If the queue of an
+ * event is full, it stays in the lane until the Java thread frees space.
+ *
+ * @param lane the index of the lane returned by LLEVENT_registerProducerLane().
+ * @param type the type of the event.
+ * @param data the data of the event.
+ * @return NO_ERR on success, ERR_WRONG_ARGS if the arguments are invalid, ERR_FIFO_FULL if the lane is full.
+ */
+int32_t LLEVENT_offerLaneEvent(int32_t lane, int32_t type, int32_t data);
+
+/**
+ * Offers an extended event to a producer lane. Same as LLEVENT_offerLaneEvent(): the data is copied into the lane,
+ * then into the payload buffer of its queue.
+ *
+ * @param lane the index of the lane returned by LLEVENT_registerProducerLane().
+ * @param type the type of the event.
+ * @param data the data of the event.
+ * @param data_length the number of bytes of data, at most LLEVENT_AMP_MAX_DATA_LENGTH and the size of the payload
+ * buffer of its queue.
+ * @return NO_ERR on success, ERR_WRONG_ARGS if the arguments are invalid, ERR_FIFO_FULL if the lane is full or if the
+ * data cannot fit in the payload buffer of its queue.
+ */
+int32_t LLEVENT_offerLaneExtendedEvent(int32_t lane, int32_t type, void* data, int32_t data_length);
+
+/**
+ * Registers a producer lane, see LLEVENT_registerProducerLane().
+ *
+ * @return the index of the lane, -1 if all the lanes are registered.
+ */
+int32_t LLEVENT_IMPL_register_producer_lane(void);
+
+/**
+ * Offers an event to a producer lane, see LLEVENT_offerLaneEvent(). The arguments are checked by the caller.
+ *
+ * @return true if the event has been written into the lane (or discarded by the type filter), false otherwise.
+ */
+bool LLEVENT_IMPL_offer_lane_event(uint32_t lane, uint32_t type, uint32_t data);
+
+/**
+ * Offers an extended event to a producer lane, see LLEVENT_offerLaneExtendedEvent(). The arguments are checked by the
+ * caller.
+ *
+ * @return true if the event has been written into the lane (or discarded by the type filter), false otherwise.
+ */
+bool LLEVENT_IMPL_offer_lane_extended_event(uint32_t lane, uint32_t type, const void* data, uint32_t data_length);
+
+#endif // EVENT_PRODUCER_LANE_COUNT > 0
+
+#if EVENT_MAPPED_DATA_SUPPORT == 1
+
+/**
+ * Offers an extended event whose data is not copied: only a reference to the data is queued and the Java listener
+ * reads the data in place, from the buffer of the producer.
+ *
+ * The buffer must not be modified until release is called. It is called by the Java thread once the Java listener
+ * ends the read of the event (LLEVENT_IMPL_end_read_extended_data()), it must not block. If the offer fails, release is
+ * not called and the buffer is given back to the caller at once. If the event is spilled into the overflow ring (see
+ * LLEVENT_setTypeOverflowPolicy()), its data is copied and release is called before the offer returns.
+ *
+ * The event takes a few words of the payload buffer whatever its data length, which can exceed
+ * EVENT_PAYLOAD_BUFFER_SIZE.
+ *
+ * @param type the type of the event.
+ * @param data the data of the event, not NULL.
+ * @param data_length the number of bytes of data, lower than LLEVENT_FRAMING_DATA_MASK.
+ * @param release the function called once the data has been read, NULL if none.
+ * @param release_arg the argument given to release.
+ * @return NO_ERR on success, ERR_WRONG_ARGS if the arguments are invalid, ERR_FIFO_FULL if the queue is full.
+ */
+int32_t LLEVENT_offerMappedExtendedEvent(int32_t type, const void* data, int32_t data_length,
+                                         LLEVENT_release_callback_t release, void* release_arg);
+
+/**
+ * Offers an extended event whose data is not copied. The arguments are not checked.
+ *
+ * @param type the type of the event.
+ * @param data the data of the event.
+ * @param data_length the number of bytes of data.
+ * @param release the function called once the data has been read, NULL if none.
+ * @param release_arg the argument given to release.
+ * @return true if the message has been sent, false otherwise.
+ */
+bool LLEVENT_IMPL_offer_mapped_extended_event(uint32_t type, const void* data, uint32_t data_length,
+                                              LLEVENT_release_callback_t release, void* release_arg);
+
+#if EVENT_ISR_SUPPORT == 1
+
+/**
+ * Offers an extended event whose data is not copied from an interrupt handler, typically at the end of a DMA
+ * transfer.
+ *
+ * Same as LLEVENT_offerMappedExtendedEvent() but can only be called from an interrupt handler.
+ *
+ * @param type the type of the event.
+ * @param data the data of the event, not NULL.
+ * @param data_length the number of bytes of data, lower than LLEVENT_FRAMING_DATA_MASK.
+ * @param release the function called once the data has been read, NULL if none.
+ * @param release_arg the argument given to release.
+ * @return NO_ERR on success, ERR_WRONG_ARGS if the arguments are invalid, ERR_FIFO_FULL if the queue is full.
+ */
+int32_t LLEVENT_offerMappedExtendedEventFromISR(int32_t type, const void* data, int32_t data_length,
+                                                LLEVENT_release_callback_t release, void* release_arg);
+
+/**
+ * Offers an extended event whose data is not copied from an interrupt handler. The arguments are not checked.
+ *
+ * @param type the type of the event.
+ * @param data the data of the event.
+ * @param data_length the number of bytes of data.
+ * @param release the function called once the data has been read, NULL if none.
+ * @param release_arg the argument given to release.
+ * @return true if the message has been sent, false otherwise.
+ */
+bool LLEVENT_IMPL_offer_mapped_extended_event_from_isr(uint32_t type, const void* data, uint32_t data_length,
+                                                       LLEVENT_release_callback_t release, void* release_arg);
+
+#endif // EVENT_ISR_SUPPORT == 1
+
+#endif // EVENT_MAPPED_DATA_SUPPORT == 1
+
+#if EVENT_BLOCKING_OFFER_SUPPORT == 1
+
+/**
+ * Offers an event to the queue, waiting for space in the queue if it is full.
+ *
+ * Same as LLEVENT_offerEvent() but, if the queue of the event is full, the producer thread is blocked until the Java
+ * thread frees space or the timeout expires. Cannot be called from an interrupt handler. An event of a type with an
+ * overflow policy is spilled instead, the producer thread is only blocked while the overflow ring is full (see
+ * LLEVENT_setTypeOverflowPolicy()).
+ *
+ * @param type the type of the event.
+ * @param data the data of the event.
+ * @param timeout the max time to wait in ThreadX ticks, TX_NO_WAIT to return immediately or TX_WAIT_FOREVER.
+ * @return NO_ERR on success, ERR_WRONG_ARGS if the arguments are invalid, ERR_FIFO_FULL if the queue is still full
+ * after the timeout.
+ */
+int32_t LLEVENT_offerEventWithTimeout(int32_t type, int32_t data, uint32_t timeout);
+
+/**
+ * Offers an extended event to the queue, waiting for space in the queue if it is full.
+ *
+ * Same as LLEVENT_offerExtendedEvent() but, if the queue of the event is full, the producer thread is blocked until
+ * the Java thread frees space or the timeout expires. Cannot be called from an interrupt handler. An event of a type
+ * with an overflow policy is spilled instead, see LLEVENT_offerEventWithTimeout().
+ *
+ * @param type the type of the event.
+ * @param data the data of the event.
+ * @param data_length the number of bytes of data.
+ * @param timeout the max time to wait in ThreadX ticks, TX_NO_WAIT to return immediately or TX_WAIT_FOREVER.
+ * @return NO_ERR on success, ERR_WRONG_ARGS if the arguments are invalid, ERR_FIFO_FULL if the queue is still full
+ * after the timeout.
+ */
+int32_t LLEVENT_offerExtendedEventWithTimeout(int32_t type, void* data, int32_t data_length, uint32_t timeout);
+
+/**
+ * Offers an event to the queue, waiting for space in the queue if it is full. The arguments are not checked.
+ *
+ * @param type the type of the event.
+ * @param data the data of the event.
+ * @param timeout the max time to wait in ThreadX ticks, TX_NO_WAIT or TX_WAIT_FOREVER.
+ * @return true if the message has been sent, false otherwise.
+ */
+bool LLEVENT_IMPL_offer_event_with_timeout(uint32_t type, uint32_t data, uint32_t timeout);
+
+/**
+ * Offers an extended event to the queue, waiting for space in the queue if it is full. The arguments are not checked.
+ *
+ * @param type the type of the event.
+ * @param data the data of the event.
+ * @param data_length the number of bytes of data.
+ * @param timeout the max time to wait in ThreadX ticks, TX_NO_WAIT or TX_WAIT_FOREVER.
+ * @return true if the message has been sent, false otherwise.
+ */
+bool LLEVENT_IMPL_offer_extended_event_with_timeout(uint32_t type, const void* data, uint32_t data_length,
+                                                    uint32_t timeout);
+
+#endif // EVENT_BLOCKING_OFFER_SUPPORT == 1
+
+#if EVENT_ISR_SUPPORT == 1
+
+/**
+ * Offers an event to the queue from an interrupt handler.
+ *
+ * Same as LLEVENT_offerEvent() but can only be called from an interrupt handler. If the Java thread is waiting for an
+ * event, its wakeup is deferred to the event wakeup thread.
+ *
+ * @param type the type of the event.
+ * @param data the data of the event.
+ * @return NO_ERR on success, ERR_WRONG_ARGS if the arguments are invalid, ERR_FIFO_FULL if the queue is full.
+ */
+int32_t LLEVENT_offerEventFromISR(int32_t type, int32_t data);
+
+/**
+ * Offers an extended event to the queue from an interrupt handler.
+ *
+ * Same as LLEVENT_offerExtendedEvent() but can only be called from an interrupt handler. If the Java thread is waiting
+ * for an event, its wakeup is deferred to the event wakeup thread.
+ *
+ * @param type the type of the event.
+ * @param data the data of the event.
+ * @param data_length the number of bytes of data.
+ * @return NO_ERR on success, ERR_WRONG_ARGS if the arguments are invalid, ERR_FIFO_FULL if the queue is full.
+ */
+int32_t LLEVENT_offerExtendedEventFromISR(int32_t type, void* data, int32_t data_length);
+
+/**
+ * Offers an event to the queue from an interrupt handler. The arguments are not checked.
+ *
+ * @param type the type of the event.
+ * @param data the data of the event.
+ * @return true if the message has been sent, false otherwise.
+ */
+bool LLEVENT_IMPL_offer_event_from_isr(uint32_t type, uint32_t data);
+
+/**
+ * Offers an extended event to the queue from an interrupt handler. The arguments are not checked.
+ *
+ * @param type the type of the event.
+ * @param data the data of the event.
+ * @param data_length the number of bytes of data.
+ * @return true if the message has been sent, false otherwise.
+ */
+bool LLEVENT_IMPL_offer_extended_event_from_isr(uint32_t type, const void* data, uint32_t data_length);
+
+/**
+ * Offers a batch of events to the queue as a single transaction from an interrupt handler.
+ *
+ * Same as LLEVENT_offerEvents() but can only be called from an interrupt handler. The interrupts are locked out while
+ * the events are copied with the ThreadX queue backend.
+ *
+ * @param events the events of the batch.
+ * @param count the number of events, between 1 and LLEVENT_BATCH_MAX_EVENTS.
+ * @return NO_ERR on success, ERR_WRONG_ARGS if the arguments are invalid or the events have different priorities,
+ * ERR_FIFO_FULL if the queue does not have enough space for the whole batch.
+ */
+int32_t LLEVENT_offerEventsFromISR(const LLEVENT_batch_event_t* events, int32_t count);
+
+/**
+ * Offers a batch of events to the queue as a single transaction from an interrupt handler. The arguments are not
+ * checked.
+ *
+ * @param events the events of the batch, all of the same priority.
+ * @param count the number of events, between 1 and LLEVENT_BATCH_MAX_EVENTS.
+ * @return true if the events have been sent, false otherwise.
+ */
+bool LLEVENT_IMPL_offer_events_from_isr(const LLEVENT_batch_event_t* events, uint32_t count);
+
+#endif // EVENT_ISR_SUPPORT == 1
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // LLEVENT_THREADX_H
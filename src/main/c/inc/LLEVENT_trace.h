@@ -0,0 +1,91 @@
+/*
+ * C
+ *
+ * Copyright 2026 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+#ifndef  LLEVENT_TRACE_H
+#define  LLEVENT_TRACE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @file
+ * @brief LLEVENT trace hooks of the ThreadX implementation (see EVENT_TRACE).
+ * @author MicroEJ Developer Team
+ * @version 1.0.1
+ *
+ * Each hook records a trace event with two 32-bit parameters:
+ * 	- LLEVENT_TRACE_EVENT_OFFER: an event has been queued. Parameters: the event, the priority of its queue.
+ * 	- LLEVENT_TRACE_EVENT_QUEUE_FULL: an event has not been queued because its queue is full. Parameters: the event,
+ * 	  the priority of its queue.
+ * 	- LLEVENT_TRACE_EVENT_DEQUEUE: an event has been fetched by a Java thread. Parameters: the event, the priority of
+ * 	  its queue.
+ * 	- LLEVENT_TRACE_EVENT_SUSPEND: a Java thread is suspended until an event is offered. Parameters: the Java thread
+ * 	  ID, the consumer.
+ * 	- LLEVENT_TRACE_EVENT_RESUME: a Java thread waiting for an event is resumed (or its resume is deferred to the
+ * 	  wakeup thread from an interrupt). Parameters: the Java thread ID, the consumer.
+ * The first word of an extended event is recorded, its data length instead of its data.
+ *
+ * When EVENT_TRACE is EVENT_TRACE_NONE, the hooks are empty and their arguments are not evaluated.
+ */
+
+#include <stdint.h>
+#include "sni.h"
+#include "event_configuration.h"
+
+/** The trace events, offsets from the first event ID of the trace module. */
+#define LLEVENT_TRACE_EVENT_OFFER         (0u)
+#define LLEVENT_TRACE_EVENT_QUEUE_FULL    (1u)
+#define LLEVENT_TRACE_EVENT_DEQUEUE       (2u)
+#define LLEVENT_TRACE_EVENT_SUSPEND       (3u)
+#define LLEVENT_TRACE_EVENT_RESUME        (4u)
+/** The number of trace events. */
+#define LLEVENT_TRACE_EVENT_COUNT         (5u)
+
+#if EVENT_TRACE == EVENT_TRACE_TRACEX
+
+#include "tx_api.h"
+
+// Unused return value: the event is not recorded if the trace buffer is not enabled.
+#define LLEVENT_TRACE_RECORD(event, param_1, param_2) \
+	((void)tx_trace_user_event_insert((ULONG)EVENT_TRACEX_EVENT_ID + (ULONG)(event), (ULONG)(param_1), \
+	                                  (ULONG)(param_2), 0, 0))
+
+#define LLEVENT_TRACE_initialize() ((void)0)
+
+#elif EVENT_TRACE == EVENT_TRACE_SYSTEMVIEW
+
+#include "SEGGER_SYSVIEW.h"
+
+/**
+ * The SystemView module of the trace events, registered by LLEVENT_TRACE_initialize(). SystemView gives it its first
+ * event ID.
+ */
+extern SEGGER_SYSVIEW_MODULE LLEVENT_TRACE_module;
+
+#define LLEVENT_TRACE_RECORD(event, param_1, param_2) \
+	SEGGER_SYSVIEW_RecordU32x2(LLEVENT_TRACE_module.EventOffset + (unsigned)(event), (U32)(param_1), (U32)(param_2))
+
+/**
+ * Registers the SystemView module of the trace events. Called by LLEVENT_IMPL_initialize(), once SystemView is
+ * initialized.
+ */
+void LLEVENT_TRACE_initialize(void);
+
+#else
+
+#define LLEVENT_TRACE_RECORD(event, param_1, param_2) ((void)0)
+
+#define LLEVENT_TRACE_initialize() ((void)0)
+
+#endif // EVENT_TRACE == EVENT_TRACE_TRACEX
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // LLEVENT_TRACE_H
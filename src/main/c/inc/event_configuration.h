@@ -21,10 +21,281 @@ extern "C" {
 
 
 /**
- * Max number of events in the queue.
+ * Number of event queues, one per priority level (see LLEVENT_setTypePriority()).
+ * The events of a queue with a higher priority are always read first, a full queue does not prevent the events of
+ * the other priorities to be offered.
+ */
+#define EVENT_QUEUE_COUNT (1)
+
+/**
+ * Number of consumers of the events, each one a Java thread waiting for the events of its own queues. Consumer 0 waits
+ * with LLEVENT_IMPL_wait_event() and LLEVENT_IMPL_wait_events(), all the consumers can wait with
+ * LLEVENT_IMPL_wait_consumer_event() and LLEVENT_IMPL_wait_consumer_events() when there are several of them.
+ * Between 1 (default) and 255.
+ */
+#define EVENT_CONSUMER_COUNT (1)
+
+/**
+ * Consumer of the queue of each priority, from the lowest priority to the highest, as an initializer of an array of
+ * EVENT_QUEUE_COUNT consumers lower than EVENT_CONSUMER_COUNT (e.g. { 0, 1 } for the urgent events dispatched by their
+ * own Java thread). A missing consumer is replaced by consumer 0.
+ */
+#define EVENT_QUEUE_CONSUMERS { 0 }
+
+/**
+ * Max number of events in each queue.
  */
 #define EVENT_QUEUE_SIZE (100)
 
+/**
+ * Size in bytes of the buffer storing the data of the extended events of each queue (must be a multiple of 4).
+ * The data of each extended event is rounded up to a multiple of 4 bytes and 4 bytes of the buffer always remain
+ * unused.
+ */
+#define EVENT_PAYLOAD_BUFFER_SIZE (1024)
+
+/**
+ * Number of bits of the type of an event: the event types are between 0 and 2^EVENT_TYPE_BITS - 1. The layout of the
+ * events must match the one decoded by the Java event queue of the MicroEJ Architecture: 7 bits of type and 24 bits
+ * of data (see LLEVENT_framing.h).
+ */
+#define EVENT_TYPE_BITS (7)
+
+/**
+ * Number of bits of the data of a simple event and of the data length of an extended event. EVENT_TYPE_BITS +
+ * EVENT_DATA_BITS must not exceed 31.
+ */
+#define EVENT_DATA_BITS (24)
+
+/**
+ * Max number of events of the queue of each priority, from the lowest priority to the highest, as an initializer of
+ * an array of EVENT_QUEUE_COUNT sizes (e.g. { 200, 20 } for a deep queue of simple events at the lowest priority and
+ * a short urgent queue). A missing or 0 size is replaced by EVENT_QUEUE_SIZE.
+ */
+#define EVENT_QUEUE_SIZES { EVENT_QUEUE_SIZE }
+
+/**
+ * Size in bytes of the payload buffer of each priority, from the lowest priority to the highest, as an initializer of
+ * an array of EVENT_QUEUE_COUNT sizes (multiples of 4, at least 4). A missing or 0 size is replaced by
+ * EVENT_PAYLOAD_BUFFER_SIZE.
+ */
+#define EVENT_PAYLOAD_BUFFER_SIZES { EVENT_PAYLOAD_BUFFER_SIZE }
+
+/**
+ * Number of events of the pool allocated statically for all the queues, at least the sum of the sizes of the queues.
+ * Must be updated with EVENT_QUEUE_SIZES.
+ */
+#define EVENT_QUEUE_POOL_SIZE ((EVENT_QUEUE_COUNT) * (EVENT_QUEUE_SIZE))
+
+/**
+ * Size in bytes of the pool allocated statically for all the payload buffers, at least the sum of the sizes of the
+ * payload buffers. Must be updated with EVENT_PAYLOAD_BUFFER_SIZES.
+ */
+#define EVENT_PAYLOAD_POOL_SIZE ((EVENT_QUEUE_COUNT) * (EVENT_PAYLOAD_BUFFER_SIZE))
+
+/**
+ * Attribute of the pools storing the events, the data of the extended events and, with EVENT_INSTRUMENTATION, their
+ * timestamps. Can place them in a dedicated memory, e.g. __attribute__((section(".sram4"))). The pools are not
+ * required to be initialized at startup. Empty by default.
+ */
+#define EVENT_STORAGE_ATTRIBUTE
+
+/**
+ * Size in bytes of the buffer into which the data of an extended event is copied at once when the Java listener starts
+ * to read it (multiple of 4, e.g. 256). The typed reads of a staged event are then served from this buffer with the
+ * same alignment rules, without per-word bookkeeping. The data of the larger extended events is read from the payload
+ * buffer as without staging. Set to 0 (default) to disable the staging.
+ */
+#define EVENT_READ_STAGING_BUFFER_SIZE (0)
+
+/**
+ * Set to 1 to allow the coalescing of the events of a type with LLEVENT_setTypeCoalescing(): a new event replaces the
+ * previous event of the same type that is still in the queue. Requires 4 bytes of RAM per event type.
+ */
+#define EVENT_COALESCING_SUPPORT (0)
+
+/**
+ * Set to 1 to allow the events of a type to be dropped at the source with LLEVENT_setTypeEnabled(): the events of a
+ * disabled type are discarded before entering the critical section and never take a place in the queues. Requires
+ * 4 bytes of RAM per 32 event types.
+ */
+#define EVENT_TYPE_FILTER_SUPPORT (0)
+
+/**
+ * Set to 1 to allow the policy applied to the events of a type offered to a full queue to be set with
+ * LLEVENT_setTypeOverflowPolicy(): rejected (default), spilled into an overflow ring until space is available, or
+ * spilled and moved into the queue in place of its oldest event. Also counts the events lost per type (see
+ * LLEVENT_IMPL_get_type_dropped_events()). Requires an overflow ring of 1 KB and 5 bytes of RAM per event type.
+ */
+#define EVENT_OVERFLOW_POLICY_SUPPORT (0)
+
+/**
+ * Set to 1 to allow extended events whose data is read in place from the buffer of the producer with
+ * LLEVENT_offerMappedExtendedEvent(). Adds one word to the data of each extended event in the payload buffer.
+ */
+#define EVENT_MAPPED_DATA_SUPPORT (0)
+
+/**
+ * Number of event types whose extended events can be delta-encoded with LLEVENT_setTypeDeltaEncoding(), 0 to disable
+ * the delta encoding. The data of an extended event of such a type is stored in the payload buffer as the bytes that
+ * differ from the previous extended event of the same type and length, and decoded when the Java listener starts to
+ * read it. Adds one word to the data of each extended event in the payload buffer and requires
+ * 2 * EVENT_DELTA_MAX_DATA_LENGTH bytes of RAM per type, plus 2 * EVENT_DELTA_MAX_DATA_LENGTH bytes shared by the
+ * types. Not available with EVENT_LOCK_FREE_QUEUE, whose producers do not write the queues one at a time.
+ */
+#define EVENT_DELTA_TYPE_COUNT (0)
+
+/**
+ * Max number of bytes of data of a delta-encoded extended event, at most 65535. The larger extended events of a
+ * delta-encoded type are copied as is.
+ */
+#define EVENT_DELTA_MAX_DATA_LENGTH (512)
+
+/**
+ * Set to 1 to replace the ThreadX queue and its mutex by a lock-free multi-producer single-consumer ring buffer of
+ * 32-bit words (requires C11 atomics).
+ * Each queue then holds its queue size + its payload buffer size / 4 + 1 words shared by the events and the data of
+ * the extended events: an extended event takes one word plus its data length rounded up to a multiple of 4 bytes.
+ */
+#define EVENT_LOCK_FREE_QUEUE (0)
+
+/**
+ * Set to 1 to allow the producers to wait for space in a full queue with LLEVENT_offerEventWithTimeout() and
+ * LLEVENT_offerExtendedEventWithTimeout(). The Java thread wakes up a blocked producer each time it frees space.
+ */
+#define EVENT_BLOCKING_OFFER_SUPPORT (0)
+
+/**
+ * Set to 1 to allow events to be offered from an interrupt handler with LLEVENT_offerEventFromISR() and
+ * LLEVENT_offerExtendedEventFromISR().
+ * When enabled, the event queue is protected by an interrupt lockout instead of a mutex and the wakeup of the Java
+ * thread requested from an interrupt is deferred to a dedicated ThreadX thread.
+ */
+#define EVENT_ISR_SUPPORT (0)
+
+/**
+ * Priority of the ThreadX thread that resumes the Java thread on behalf of an interrupt handler.
+ * Only used when EVENT_ISR_SUPPORT is set to 1. It should be higher than or equal to the priority of the MicroEJ core
+ * engine thread.
+ */
+#define EVENT_WAKEUP_THREAD_PRIORITY (1)
+
+/**
+ * Stack size (in bytes) of the ThreadX thread that resumes the Java thread on behalf of an interrupt handler.
+ * Only used when EVENT_ISR_SUPPORT is set to 1.
+ */
+#define EVENT_WAKEUP_THREAD_STACK_SIZE (512)
+
+/**
+ * Number of producer lanes, registered with LLEVENT_registerProducerLane(): each a single-producer ring of
+ * LLEVENT_AMP_RING_WORDS words (see LLEVENT_amp.h) whose events are moved into the queues by the Java threads, one event
+ * of each lane in turn, before they check the queues. A producer offering the events of its own lane with
+ * LLEVENT_offerLaneEvent() and LLEVENT_offerLaneExtendedEvent() never waits for the other producers nor for the
+ * critical section of the queues. Set to 0 (default) to disable the lanes.
+ */
+#define EVENT_PRODUCER_LANE_COUNT (0)
+
+/**
+ * Set to 1 to move the events produced by another core into the event queue from the doorbell interrupt handler
+ * with LLEVENT_AMP_doorbell_handler(), through a single-producer single-consumer ring in shared memory (see
+ * LLEVENT_amp.h). Requires EVENT_ISR_SUPPORT.
+ */
+#define EVENT_AMP_BRIDGE_SUPPORT (0)
+
+/**
+ * Number of events offered before the waiting Java thread is resumed. Set to 1 (default) to resume it as soon as an
+ * event is offered. With a higher value, the Java thread is resumed once EVENT_WAKEUP_BATCH_SIZE events have been
+ * offered since it started to wait, or EVENT_WAKEUP_DELAY ticks after the first of them, so that a burst of events is
+ * dispatched with a single wakeup (see LLEVENT_IMPL_wait_events()). The events of the types set as urgent with
+ * LLEVENT_setTypeUrgent() resume it at once. Requires 1 byte of RAM per event type.
+ */
+#define EVENT_WAKEUP_BATCH_SIZE (1)
+
+/**
+ * Max delay in ThreadX ticks (at least 1) between the first event offered and the resume of the waiting Java thread,
+ * by a ThreadX timer. Only used when EVENT_WAKEUP_BATCH_SIZE is higher than 1.
+ */
+#define EVENT_WAKEUP_DELAY (1)
+
+/**
+ * Set to 1 to collect statistics on the event queues: offered and dropped events per type, high-water marks per queue,
+ * contention on the critical section and a histogram of the enqueue-to-dequeue latencies (see LLEVENT_statistics.h).
+ * Adds a timestamp per queued event and a few counters to the offer path.
+ */
+#define EVENT_INSTRUMENTATION (0)
+
+/**
+ * Set to 1 to store the offer time of each event with it, read from Java with LLEVENT_IMPL_get_event_timestamp() or
+ * LLEVENT_IMPL_wait_timestamped_events() to profile the queueing delay of each event type. The time is captured with
+ * EVENT_TIMESTAMP() when the event is queued. Adds 4 bytes of RAM per event of the queues (shared with
+ * EVENT_INSTRUMENTATION).
+ */
+#define EVENT_TIMESTAMP_SUPPORT (0)
+
+/**
+ * Number of bins of the latency histogram, bin n counting the latencies in [2^(n-1), 2^n[.
+ * Only used when EVENT_INSTRUMENTATION is set to 1.
+ */
+#define EVENT_LATENCY_HISTOGRAM_BINS (16)
+
+/**
+ * Gets the current time as an uint32_t, used to measure the latencies and the contention and to timestamp the events.
+ * Only used when EVENT_INSTRUMENTATION, EVENT_TIMESTAMP_SUPPORT or EVENT_REPLAY_LOG_SUPPORT is set to 1. Can be replaced
+ * by a cycle counter (e.g. DWT->CYCCNT on Cortex-M) for a finer resolution than the ThreadX tick.
+ */
+#define EVENT_TIMESTAMP() ((uint32_t)tx_time_get())
+
+/**
+ * Values of EVENT_TRACE: no trace hooks, TraceX user events or SEGGER SystemView events.
+ */
+#define EVENT_TRACE_NONE (0)
+#define EVENT_TRACE_TRACEX (1)
+#define EVENT_TRACE_SYSTEMVIEW (2)
+
+/**
+ * Selects the recorder of the trace hooks at the offer, queue full, dequeue, suspend and resume points (see
+ * LLEVENT_trace.h), to correlate the event latencies with the ThreadX scheduling:
+ * 	- EVENT_TRACE_NONE (default): the hooks are empty.
+ * 	- EVENT_TRACE_TRACEX: the hooks insert TraceX user events with tx_trace_user_event_insert(), ThreadX must be built
+ * 	  with TX_ENABLE_EVENT_TRACE and the trace buffer enabled with tx_trace_enable().
+ * 	- EVENT_TRACE_SYSTEMVIEW: the hooks record the events of a SystemView module, SEGGER_SYSVIEW_Init() must be called
+ * 	  before LLEVENT_IMPL_initialize().
+ */
+#define EVENT_TRACE (EVENT_TRACE_NONE)
+
+/**
+ * First TraceX user event ID of the trace hooks, followed by LLEVENT_TRACE_EVENT_COUNT IDs. Only used when EVENT_TRACE
+ * is EVENT_TRACE_TRACEX.
+ */
+#define EVENT_TRACEX_EVENT_ID (TX_TRACE_USER_EVENT_START)
+
+/**
+ * Set to 1 to record the events accepted by the queues into a replay log (see LLEVENT_replay.h): the producers append
+ * their events with their EVENT_TIMESTAMP() to a RAM ring of EVENT_REPLAY_LOG_SIZE bytes, written out in batches
+ * with EVENT_REPLAY_LOG_WRITE() by LLEVENT_REPLAY_flush(). A captured log is offered again with
+ * LLEVENT_REPLAY_replay(), at its original pace or as fast as possible.
+ */
+#define EVENT_REPLAY_LOG_SUPPORT (0)
+
+/**
+ * Size in bytes of the RAM ring of the replay log (multiple of 4). A simple event takes 8 bytes, an extended event
+ * 8 bytes plus its data length rounded up to a multiple of 4 bytes. The events recorded while the ring is full are
+ * dropped and counted. Only used when EVENT_REPLAY_LOG_SUPPORT is set to 1.
+ */
+#define EVENT_REPLAY_LOG_SIZE (4096)
+
+/**
+ * Writes length bytes of the replay log, e.g. to a file or a UART. Called by LLEVENT_REPLAY_flush() only, never by
+ * the producers. Only used when EVENT_REPLAY_LOG_SUPPORT is set to 1.
+ */
+#define EVENT_REPLAY_LOG_WRITE(data, length) ((void)fwrite((data), 1u, (length), stdout))
+
+/**
+ * Converts a difference of EVENT_TIMESTAMP() values into ThreadX ticks, to replay a log at its original pace. Must
+ * be updated with EVENT_TIMESTAMP(). Only used when EVENT_REPLAY_LOG_SUPPORT is set to 1.
+ */
+#define EVENT_REPLAY_TICKS(time) ((ULONG)(time))
+
 /**
  * Event function succeeded.
  */
@@ -14,17 +14,73 @@
 
 #include "LLEVENT.h"
 #include "LLEVENT_impl.h"
+#include "LLEVENT_threadx.h"
+#include "LLEVENT_framing.h"
+#include <stddef.h>
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
 // -----------------------------------------------------------------------------
-// Macros and Defines
+// Private function definition
 // -----------------------------------------------------------------------------
 
-#define DATA_LENGTH_MASK        0xFFFFFF
-#define MAX_TYPE_ID             128
+/**
+ * Checks the validity of the type of an event.
+ */
+static bool check_event_type(int32_t type) {
+	return (type >= (int32_t)0) && (type < (int32_t)LLEVENT_FRAMING_MAX_TYPE_ID);
+}
+
+/**
+ * Checks the validity of the type and of the data (or data length) of an event.
+ */
+static bool check_event_arguments(int32_t type, int32_t data) {
+	return check_event_type(type) && ((data & (int32_t)LLEVENT_FRAMING_DATA_MASK) == data);
+}
+
+/**
+ * Gets the status to return to the caller from the result of the arguments check and of the offer.
+ */
+static int32_t get_offer_status(bool check_parameters, bool event_sent) {
+	int32_t status;
+	if (!check_parameters) {
+		status = ERR_WRONG_ARGS;
+	} else if (!event_sent) {
+		status = ERR_FIFO_FULL;
+	} else {
+		status = NO_ERR;
+	}
+
+	return status;
+}
+
+/**
+ * Gets the status to return to the caller of a setting of a type from the result of the arguments check.
+ */
+static int32_t get_setting_status(bool check_parameters) {
+	return check_parameters ? NO_ERR : ERR_WRONG_ARGS;
+}
+
+/**
+ * Checks the validity of the events of a batch: valid types and data, the same priority for all the events and no
+ * simple event of a coalesced type, which the batch would not coalesce.
+ */
+static bool check_batch_arguments(const LLEVENT_batch_event_t* events, int32_t count) {
+	bool check_parameters = (NULL != events) && (count > (int32_t)0) && (count <= (int32_t)LLEVENT_BATCH_MAX_EVENTS);
+	for (int32_t i = 0; check_parameters && (i < count); i++) {
+		// The type of the first event is checked first.
+		check_parameters = check_event_arguments(events[i].type, events[i].data) &&
+		                   (LLEVENT_IMPL_get_type_priority(events[i].type) ==
+		                    LLEVENT_IMPL_get_type_priority(events[0].type));
+#if EVENT_COALESCING_SUPPORT == 1
+		check_parameters = check_parameters && ((NULL != events[i].extended_data) ||
+		                                        !LLEVENT_IMPL_is_type_coalescing((uint32_t)events[i].type));
+#endif // EVENT_COALESCING_SUPPORT == 1
+	}
+	return check_parameters;
+}
 
 // -----------------------------------------------------------------------------
 // Public function definition
@@ -32,7 +88,7 @@ extern "C" {
 
 int32_t LLEVENT_offerEvent(int32_t type, int32_t data) {
 	// Check the validity of the arguments.
-	bool check_parameters = (type >= (int32_t)0) && (type < (int32_t)MAX_TYPE_ID) && ((data & (int32_t)DATA_LENGTH_MASK) == data);
+	bool check_parameters = check_event_arguments(type, data);
 
 	bool event_sent = false;
 
@@ -41,22 +97,12 @@ int32_t LLEVENT_offerEvent(int32_t type, int32_t data) {
 		event_sent = LLEVENT_IMPL_offer_event(type, data);
 	}
 
-	// Set the status to return.
-	int32_t status;
-	if (!check_parameters) {
-		status = ERR_WRONG_ARGS;
-	} else if (!event_sent) {
-		status = ERR_FIFO_FULL;
-	} else {
-		status = NO_ERR;
-	}
-
-	return status;
+	return get_offer_status(check_parameters, event_sent);
 }
 
 int32_t LLEVENT_offerExtendedEvent(int32_t type, void* data, int32_t data_length) {
 	//Check the validity of the arguments.
-	bool check_parameters = (type >= (int32_t)0) && (type < (int32_t)MAX_TYPE_ID) && ((data_length & (int32_t)DATA_LENGTH_MASK) == data_length);
+	bool check_parameters = check_event_arguments(type, data_length);
 
 	bool event_sent = false;
 
@@ -65,19 +111,275 @@ int32_t LLEVENT_offerExtendedEvent(int32_t type, void* data, int32_t data_length
 		event_sent = LLEVENT_IMPL_offer_extended_event(type, data, data_length);
 	}
 
-	// Set the status to return.
-	int32_t status;
-	if (!check_parameters) {
-		status = ERR_WRONG_ARGS;
-	} else if (!event_sent) {
-		status = ERR_FIFO_FULL;
-	} else {
-		status = NO_ERR;
+	return get_offer_status(check_parameters, event_sent);
+}
+
+int32_t LLEVENT_offerEvents(const LLEVENT_batch_event_t* events, int32_t count) {
+	// Check the validity of the arguments.
+	bool check_parameters = check_batch_arguments(events, count);
+
+	bool event_sent = false;
+
+	if (check_parameters) {
+		// Try to offer the events.
+		event_sent = LLEVENT_IMPL_offer_events(events, count);
+	}
+
+	return get_offer_status(check_parameters, event_sent);
+}
+
+#if EVENT_PRODUCER_LANE_COUNT > 0
+
+int32_t LLEVENT_registerProducerLane(void) {
+	int32_t lane = LLEVENT_IMPL_register_producer_lane();
+	return (lane >= (int32_t)0) ? lane : ERR_FIFO_FULL;
+}
+
+int32_t LLEVENT_offerLaneEvent(int32_t lane, int32_t type, int32_t data) {
+	// Check the validity of the arguments.
+	bool check_parameters = (lane >= (int32_t)0) && (lane < (int32_t)EVENT_PRODUCER_LANE_COUNT) &&
+	                        check_event_arguments(type, data);
+
+	bool event_sent = false;
+
+	if (check_parameters) {
+		// Try to write the event into the lane.
+		event_sent = LLEVENT_IMPL_offer_lane_event((uint32_t)lane, (uint32_t)type, (uint32_t)data);
+	}
+
+	return get_offer_status(check_parameters, event_sent);
+}
+
+int32_t LLEVENT_offerLaneExtendedEvent(int32_t lane, int32_t type, void* data, int32_t data_length) {
+	// Check the validity of the arguments.
+	bool check_parameters = (lane >= (int32_t)0) && (lane < (int32_t)EVENT_PRODUCER_LANE_COUNT) &&
+	                        check_event_arguments(type, data_length) && (NULL != data);
+
+	bool event_sent = false;
+
+	if (check_parameters) {
+		// Try to write the extended event into the lane.
+		event_sent = LLEVENT_IMPL_offer_lane_extended_event((uint32_t)lane, (uint32_t)type, data, (uint32_t)data_length);
+	}
+
+	return get_offer_status(check_parameters, event_sent);
+}
+
+#endif // EVENT_PRODUCER_LANE_COUNT > 0
+
+#if EVENT_MAPPED_DATA_SUPPORT == 1
+
+/**
+ * Checks the validity of the arguments of a mapped extended event. The data length LLEVENT_FRAMING_DATA_MASK is
+ * reserved.
+ */
+static bool check_mapped_event_arguments(int32_t type, const void* data, int32_t data_length) {
+	return check_event_arguments(type, data_length) && (NULL != data) && (data_length != (int32_t)LLEVENT_FRAMING_DATA_MASK);
+}
+
+int32_t LLEVENT_offerMappedExtendedEvent(int32_t type, const void* data, int32_t data_length,
+                                         LLEVENT_release_callback_t release, void* release_arg) {
+	// Check the validity of the arguments.
+	bool check_parameters = check_mapped_event_arguments(type, data, data_length);
+
+	bool event_sent = false;
+
+	if (check_parameters) {
+		// Try to offer the extended event.
+		event_sent = LLEVENT_IMPL_offer_mapped_extended_event(type, data, data_length, release, release_arg);
+	}
+
+	return get_offer_status(check_parameters, event_sent);
+}
+
+#if EVENT_ISR_SUPPORT == 1
+
+int32_t LLEVENT_offerMappedExtendedEventFromISR(int32_t type, const void* data, int32_t data_length,
+                                                LLEVENT_release_callback_t release, void* release_arg) {
+	// Check the validity of the arguments.
+	bool check_parameters = check_mapped_event_arguments(type, data, data_length);
+
+	bool event_sent = false;
+
+	if (check_parameters) {
+		// Try to offer the extended event.
+		event_sent = LLEVENT_IMPL_offer_mapped_extended_event_from_isr(type, data, data_length, release, release_arg);
+	}
+
+	return get_offer_status(check_parameters, event_sent);
+}
+
+#endif // EVENT_ISR_SUPPORT == 1
+
+#endif // EVENT_MAPPED_DATA_SUPPORT == 1
+
+int32_t LLEVENT_setTypePriority(int32_t type, int32_t priority) {
+	// Check the validity of the arguments.
+	bool check_parameters = check_event_type(type) &&
+	                        (priority >= (int32_t)0) && (priority < (int32_t)EVENT_QUEUE_COUNT);
+
+	if (check_parameters) {
+		LLEVENT_IMPL_set_type_priority(type, priority);
+	}
+
+	return get_setting_status(check_parameters);
+}
+
+#if EVENT_WAKEUP_BATCH_SIZE > 1
+
+int32_t LLEVENT_setTypeUrgent(int32_t type, bool urgent) {
+	// Check the validity of the arguments.
+	bool check_parameters = check_event_type(type);
+
+	if (check_parameters) {
+		LLEVENT_IMPL_set_type_urgent(type, urgent);
+	}
+
+	return get_setting_status(check_parameters);
+}
+
+#endif // EVENT_WAKEUP_BATCH_SIZE > 1
+
+#if EVENT_COALESCING_SUPPORT == 1
+
+int32_t LLEVENT_setTypeCoalescing(int32_t type, bool coalescing) {
+	// Check the validity of the arguments.
+	bool check_parameters = check_event_type(type);
+
+	if (check_parameters) {
+		LLEVENT_IMPL_set_type_coalescing(type, coalescing);
+	}
+
+	return get_setting_status(check_parameters);
+}
+
+#endif // EVENT_COALESCING_SUPPORT == 1
+
+#if EVENT_TYPE_FILTER_SUPPORT == 1
+
+int32_t LLEVENT_setTypeEnabled(int32_t type, bool enabled) {
+	// Check the validity of the arguments.
+	bool check_parameters = check_event_type(type);
+
+	if (check_parameters) {
+		LLEVENT_IMPL_set_type_enabled(type, enabled);
+	}
+
+	return get_setting_status(check_parameters);
+}
+
+#endif // EVENT_TYPE_FILTER_SUPPORT == 1
+
+#if EVENT_OVERFLOW_POLICY_SUPPORT == 1
+
+int32_t LLEVENT_setTypeOverflowPolicy(int32_t type, int32_t policy) {
+	// Check the validity of the arguments.
+	bool check_parameters = check_event_type(type) &&
+	                        (policy >= LLEVENT_OVERFLOW_REJECT) && (policy <= LLEVENT_OVERFLOW_SPILL);
+
+	if (check_parameters) {
+		LLEVENT_IMPL_set_type_overflow_policy(type, policy);
+	}
+
+	return get_setting_status(check_parameters);
+}
+
+#endif // EVENT_OVERFLOW_POLICY_SUPPORT == 1
+
+#if EVENT_DELTA_TYPE_COUNT > 0
+
+int32_t LLEVENT_setTypeDeltaEncoding(int32_t type, bool encoding) {
+	// Check the validity of the arguments.
+	bool check_parameters = check_event_type(type);
+
+	int32_t status = ERR_WRONG_ARGS;
+	if (check_parameters) {
+		status = LLEVENT_IMPL_set_type_delta_encoding((uint32_t)type, encoding) ? NO_ERR : ERR_FIFO_FULL;
 	}
 
 	return status;
 }
 
+#endif // EVENT_DELTA_TYPE_COUNT > 0
+
+#if EVENT_BLOCKING_OFFER_SUPPORT == 1
+
+int32_t LLEVENT_offerEventWithTimeout(int32_t type, int32_t data, uint32_t timeout) {
+	// Check the validity of the arguments.
+	bool check_parameters = check_event_arguments(type, data);
+
+	bool event_sent = false;
+
+	if (check_parameters) {
+		// Try to offer the event, waiting for space.
+		event_sent = LLEVENT_IMPL_offer_event_with_timeout(type, data, timeout);
+	}
+
+	return get_offer_status(check_parameters, event_sent);
+}
+
+int32_t LLEVENT_offerExtendedEventWithTimeout(int32_t type, void* data, int32_t data_length, uint32_t timeout) {
+	// Check the validity of the arguments.
+	bool check_parameters = check_event_arguments(type, data_length);
+
+	bool event_sent = false;
+
+	if (check_parameters) {
+		// Try to offer the extended event, waiting for space.
+		event_sent = LLEVENT_IMPL_offer_extended_event_with_timeout(type, data, data_length, timeout);
+	}
+
+	return get_offer_status(check_parameters, event_sent);
+}
+
+#endif // EVENT_BLOCKING_OFFER_SUPPORT == 1
+
+#if EVENT_ISR_SUPPORT == 1
+
+int32_t LLEVENT_offerEventFromISR(int32_t type, int32_t data) {
+	// Check the validity of the arguments.
+	bool check_parameters = check_event_arguments(type, data);
+
+	bool event_sent = false;
+
+	if (check_parameters) {
+		// Try to offer the event.
+		event_sent = LLEVENT_IMPL_offer_event_from_isr(type, data);
+	}
+
+	return get_offer_status(check_parameters, event_sent);
+}
+
+int32_t LLEVENT_offerExtendedEventFromISR(int32_t type, void* data, int32_t data_length) {
+	// Check the validity of the arguments.
+	bool check_parameters = check_event_arguments(type, data_length);
+
+	bool event_sent = false;
+
+	if (check_parameters) {
+		// Try to offer the extended event.
+		event_sent = LLEVENT_IMPL_offer_extended_event_from_isr(type, data, data_length);
+	}
+
+	return get_offer_status(check_parameters, event_sent);
+}
+
+int32_t LLEVENT_offerEventsFromISR(const LLEVENT_batch_event_t* events, int32_t count) {
+	// Check the validity of the arguments.
+	bool check_parameters = check_batch_arguments(events, count);
+
+	bool event_sent = false;
+
+	if (check_parameters) {
+		// Try to offer the events.
+		event_sent = LLEVENT_IMPL_offer_events_from_isr(events, count);
+	}
+
+	return get_offer_status(check_parameters, event_sent);
+}
+
+#endif // EVENT_ISR_SUPPORT == 1
+
 #ifdef __cplusplus
 }
 #endif
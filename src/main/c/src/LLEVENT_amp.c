@@ -0,0 +1,70 @@
+/*
+ * C
+ *
+ * Copyright 2026 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/**
+ * @file
+ * @brief LLEVENT bridge of the events produced by another core: VM core side, moves the events into the event queue.
+ * @author MicroEJ Developer Team
+ * @version 1.0.1
+ */
+
+// -----------------------------------------------------------------------------
+// Includes
+// -----------------------------------------------------------------------------
+
+#include "LLEVENT_amp.h"
+#include "LLEVENT.h"
+#include "LLEVENT_threadx.h"
+#include "event_configuration.h"
+
+#if EVENT_AMP_BRIDGE_SUPPORT == 1
+
+#if EVENT_ISR_SUPPORT == 0
+#error "EVENT_AMP_BRIDGE_SUPPORT requires EVENT_ISR_SUPPORT."
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// -----------------------------------------------------------------------------
+// Macros and Defines
+// -----------------------------------------------------------------------------
+
+// Maximum number of events in a ring: a simple event takes 2 words.
+#define RING_MAX_EVENTS (LLEVENT_AMP_RING_WORDS / 2u)
+
+// -----------------------------------------------------------------------------
+// Public function definition
+// -----------------------------------------------------------------------------
+
+void LLEVENT_AMP_doorbell_handler(LLEVENT_amp_ring_t* ring) {
+	LLEVENT_amp_event_t event;
+	bool available = true;
+	for (uint32_t i = 0; (i < RING_MAX_EVENTS) && available; i++) {
+		available = LLEVENT_AMP_peek_event(ring, &event);
+		if (available) {
+			int32_t status;
+			if (event.extended) {
+				// The data is copied from the ring into the payload buffer of its queue.
+				status = LLEVENT_offerExtendedEventFromISR(event.type, event.extended_data, (int32_t)event.data);
+			} else {
+				status = LLEVENT_offerEventFromISR(event.type, (int32_t)event.data);
+			}
+			if (NO_ERR != status) {
+				ring->dropped_events++;
+			}
+			LLEVENT_AMP_release_event(ring, &event);
+		}
+	}
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // EVENT_AMP_BRIDGE_SUPPORT == 1
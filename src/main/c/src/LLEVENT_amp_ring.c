@@ -0,0 +1,153 @@
+/*
+ * C
+ *
+ * Copyright 2026 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/**
+ * @file
+ * @brief LLEVENT single-producer single-consumer ring of the events produced by another core or by a producer lane.
+ * @author MicroEJ Developer Team
+ * @version 1.0.1
+ */
+
+// -----------------------------------------------------------------------------
+// Includes
+// -----------------------------------------------------------------------------
+
+#include "LLEVENT_amp.h"
+#include <stddef.h>
+#include <string.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// -----------------------------------------------------------------------------
+// Macros and Defines
+// -----------------------------------------------------------------------------
+
+#define RING_INDEX_MASK (LLEVENT_AMP_RING_WORDS - 1u)
+
+#if (LLEVENT_AMP_RING_WORDS & RING_INDEX_MASK) != 0u
+#error "LLEVENT_AMP_RING_WORDS must be a power of 2."
+#endif
+
+// -----------------------------------------------------------------------------
+// Private function definition
+// -----------------------------------------------------------------------------
+
+/**
+ * Writes an event of a number of words into the ring: its header word, its data word and data_length bytes of data.
+ *
+ * @return true if the event has been written, false if the ring is full.
+ */
+static bool offer_words(LLEVENT_amp_ring_t* ring, uint32_t header, uint32_t value, const void* data,
+                        uint32_t data_length) {
+	uint32_t event_words = 2u + ((data_length + 3u) / 4u);
+	uint32_t write_index = atomic_load_explicit(&ring->write_index, memory_order_relaxed);
+	// Acquire: the words freed by the VM core are no longer read.
+	uint32_t read_index = atomic_load_explicit(&ring->read_index, memory_order_acquire);
+
+	// An event never wraps around the end of the ring: skip the end of the ring if the event does not fit.
+	uint32_t offset = write_index & RING_INDEX_MASK;
+	uint32_t padding_words = 0u;
+	if (event_words > (LLEVENT_AMP_RING_WORDS - offset)) {
+		padding_words = LLEVENT_AMP_RING_WORDS - offset;
+	}
+
+	// The header of an event must not be read as a padding.
+	bool event_sent = (LLEVENT_AMP_PADDING != header) &&
+	                  ((write_index - read_index + padding_words + event_words) <= LLEVENT_AMP_RING_WORDS);
+	if (event_sent) {
+		if (0u != padding_words) {
+			ring->words[offset] = LLEVENT_AMP_PADDING;
+			offset = 0u;
+		}
+		ring->words[offset] = header;
+		ring->words[offset + 1u] = value;
+		if (0u != data_length) {
+			// Zero the padding bytes of the last word.
+			ring->words[offset + event_words - 1u] = 0u;
+			(void)memcpy(&ring->words[offset + 2u], data, data_length);
+		}
+		// Release: the words of the event are written before the VM core reads them.
+		atomic_store_explicit(&ring->write_index, write_index + padding_words + event_words, memory_order_release);
+	}
+	return event_sent;
+}
+
+// -----------------------------------------------------------------------------
+// Public function definition
+// -----------------------------------------------------------------------------
+
+void LLEVENT_AMP_initialize(LLEVENT_amp_ring_t* ring) {
+	ring->dropped_events = 0u;
+	atomic_store_explicit(&ring->read_index, 0u, memory_order_relaxed);
+	atomic_store_explicit(&ring->write_index, 0u, memory_order_release);
+}
+
+bool LLEVENT_AMP_offer_event(LLEVENT_amp_ring_t* ring, int32_t type, int32_t data) {
+	return offer_words(ring, (uint32_t)type & ~LLEVENT_AMP_EXTENDED_FLAG, (uint32_t)data, NULL, 0u);
+}
+
+bool LLEVENT_AMP_offer_extended_event(LLEVENT_amp_ring_t* ring, int32_t type, const void* data, uint32_t data_length) {
+	bool event_sent = false;
+	if (data_length <= LLEVENT_AMP_MAX_DATA_LENGTH) {
+		event_sent = offer_words(ring, (uint32_t)type | LLEVENT_AMP_EXTENDED_FLAG, data_length, data, data_length);
+	}
+	return event_sent;
+}
+
+bool LLEVENT_AMP_peek_event(LLEVENT_amp_ring_t* ring, LLEVENT_amp_event_t* event) {
+	uint32_t read_index = atomic_load_explicit(&ring->read_index, memory_order_relaxed);
+	// Acquire: the words of the events are read after they have been written by the producer.
+	uint32_t write_index = atomic_load_explicit(&ring->write_index, memory_order_acquire);
+	bool available = false;
+
+	if (read_index != write_index) {
+		uint32_t offset = read_index & RING_INDEX_MASK;
+		// A padding is always followed by an event.
+		bool valid = true;
+		if (LLEVENT_AMP_PADDING == ring->words[offset]) {
+			valid = (LLEVENT_AMP_RING_WORDS - offset) < (write_index - read_index);
+			read_index += LLEVENT_AMP_RING_WORDS - offset;
+			offset = 0u;
+		}
+
+		uint32_t header = ring->words[offset];
+		uint32_t value = (offset < (LLEVENT_AMP_RING_WORDS - 1u)) ? ring->words[offset + 1u] : 0u;
+		bool extended = (header & LLEVENT_AMP_EXTENDED_FLAG) != 0u;
+		uint32_t event_words = 2u + (extended ? ((value + 3u) / 4u) : 0u);
+		// An event never exceeds the written words nor the end of the ring.
+		valid = valid && (!extended || (value <= LLEVENT_AMP_MAX_DATA_LENGTH)) &&
+		        (event_words <= (LLEVENT_AMP_RING_WORDS - offset)) && (event_words <= (write_index - read_index));
+
+		if (valid) {
+			event->type = (int32_t)(header & ~LLEVENT_AMP_EXTENDED_FLAG);
+			event->extended = extended;
+			event->data = value;
+			event->extended_data = &ring->words[offset + 2u];
+			event->words = event_words;
+			available = true;
+		} else {
+			// The next events cannot be found, drop them.
+			ring->dropped_events++;
+			read_index = write_index;
+		}
+		// Release: the words of the padding (or of the dropped events) can be written again.
+		atomic_store_explicit(&ring->read_index, read_index, memory_order_release);
+	}
+	return available;
+}
+
+void LLEVENT_AMP_release_event(LLEVENT_amp_ring_t* ring, const LLEVENT_amp_event_t* event) {
+	uint32_t read_index = atomic_load_explicit(&ring->read_index, memory_order_relaxed);
+	// Release: the words of the event have been read before the producer writes them again.
+	atomic_store_explicit(&ring->read_index, read_index + event->words, memory_order_release);
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -17,10 +17,20 @@
 // -----------------------------------------------------------------------------
 
 #include "LLEVENT_impl.h"
+#include "LLEVENT_threadx.h"
+#include "LLEVENT_framing.h"
+#include "LLEVENT_statistics.h"
+#include "LLEVENT_trace.h"
+#include "LLEVENT_replay.h"
 #include "event_configuration.h"
+#if (EVENT_PRODUCER_LANE_COUNT > 0) || (EVENT_OVERFLOW_POLICY_SUPPORT == 1)
+#include "LLEVENT_amp.h"
+#endif // (EVENT_PRODUCER_LANE_COUNT > 0) || (EVENT_OVERFLOW_POLICY_SUPPORT == 1)
 #include <stdlib.h>
 #include <string.h>
-#include <math.h>
+#if (EVENT_LOCK_FREE_QUEUE == 1) || (EVENT_PRODUCER_LANE_COUNT > 0) || (EVENT_OVERFLOW_POLICY_SUPPORT == 1)
+#include <stdatomic.h>
+#endif // (EVENT_LOCK_FREE_QUEUE == 1) || (EVENT_PRODUCER_LANE_COUNT > 0) || (EVENT_OVERFLOW_POLICY_SUPPORT == 1)
 
 #include "tx_api.h"
 
@@ -28,6 +38,22 @@
 extern "C" {
 #endif
 
+#if (EVENT_WAKEUP_BATCH_SIZE > 1) && defined(TX_TIMER_PROCESS_IN_ISR) && (EVENT_ISR_SUPPORT == 0)
+#error "EVENT_WAKEUP_BATCH_SIZE requires EVENT_ISR_SUPPORT when the ThreadX timers are processed in interrupt."
+#endif
+
+#if (EVENT_CONSUMER_COUNT < 1) || (EVENT_CONSUMER_COUNT > 255)
+#error "EVENT_CONSUMER_COUNT must be between 1 and 255."
+#endif
+
+#if (EVENT_DELTA_TYPE_COUNT > 0) && (EVENT_LOCK_FREE_QUEUE == 1)
+#error "EVENT_DELTA_TYPE_COUNT requires the ThreadX queue backend (EVENT_LOCK_FREE_QUEUE set to 0)."
+#endif
+
+#if (EVENT_DELTA_TYPE_COUNT > 255) || (EVENT_DELTA_MAX_DATA_LENGTH > 65535)
+#error "EVENT_DELTA_TYPE_COUNT must be at most 255 and EVENT_DELTA_MAX_DATA_LENGTH at most 65535."
+#endif
+
 // -----------------------------------------------------------------------------
 // Macros and Defines
 // -----------------------------------------------------------------------------
@@ -44,282 +70,3932 @@ extern "C" {
 #define SHORT_TWO_MASK          0xFFFF0000u
 #define SHORT_TWO_SHIFT         16u
 
+// 1 if the offer time of each event is stored with it, for the instrumentation or to be read from Java.
+#if (EVENT_INSTRUMENTATION == 1) || (EVENT_TIMESTAMP_SUPPORT == 1)
+#define OFFER_TIMESTAMPS        1
+#else
+#define OFFER_TIMESTAMPS        0
+#endif
+
+// Value of coalesced_events when there is no event of the type in the queues (a simple event has its bit 31 cleared).
+#define COALESCED_EVENT_NONE    0xFFFFFFFFu
+
+// Flag of an offer: the caller is an interrupt handler.
+#define OFFER_FROM_ISR          0x1u
+#if EVENT_TYPE_FILTER_SUPPORT == 1
+// Number of event types per word of disabled_types.
+#define TYPES_PER_WORD          32u
+#endif // EVENT_TYPE_FILTER_SUPPORT == 1
+
+// Flag of an offer: a full queue is not reported, the offer is retried once space is available.
+#define OFFER_RETRIED           0x2u
+
+#if (EVENT_MAPPED_DATA_SUPPORT == 1) || (EVENT_DELTA_TYPE_COUNT > 0)
+// Kind of the data of an extended event, stored in the first word of its payload: the data itself follows.
+#define EXTENDED_DATA_COPIED    0u
+// Kind of the data of an extended event, stored in the first word of its payload: a mapped_data_t follows.
+#define EXTENDED_DATA_MAPPED    1u
+#endif // (EVENT_MAPPED_DATA_SUPPORT == 1) || (EVENT_DELTA_TYPE_COUNT > 0)
+
+#if EVENT_DELTA_TYPE_COUNT > 0
+// Kind of the data of an extended event of a delta-encoded type: the data itself follows, the next extended events of
+// its type are encoded against it.
+#define EXTENDED_DATA_REFERENCE 2u
+// Kind of the data of an extended event of a delta-encoded type: the runs of bytes that differ from the previous
+// extended event of its type follow (see encode_delta()).
+#define EXTENDED_DATA_DELTA     3u
+// The first word of the payload of these kinds also holds the index of the references of the type and the number of
+// bytes that follow.
+#define DELTA_KIND_MASK         0xFFu
+#define DELTA_REFERENCE_SHIFT   8u
+#define DELTA_LENGTH_SHIFT      16u
+
+// Number of 32-bit words of the data of a delta-encoded extended event.
+#define DELTA_DATA_WORDS        (((uint32_t)EVENT_DELTA_MAX_DATA_LENGTH + 3u) / (uint32_t)sizeof(uint32_t))
+
+// Max number of bytes of a run of bytes, and of the unchanged bytes preceding it.
+#define DELTA_MAX_RUN_LENGTH    255u
+
+// Length of the reference of a type whose next extended event is stored as is.
+#define DELTA_NO_REFERENCE      0xFFFFFFFFu
+#endif // EVENT_DELTA_TYPE_COUNT > 0
+
+#if (EVENT_PRODUCER_LANE_COUNT > 0) || (EVENT_OVERFLOW_POLICY_SUPPORT == 1)
+// Maximum number of events in a producer lane or in the overflow ring: a simple event takes 2 words.
+#define RING_MAX_EVENTS         (LLEVENT_AMP_RING_WORDS / 2u)
+#endif // (EVENT_PRODUCER_LANE_COUNT > 0) || (EVENT_OVERFLOW_POLICY_SUPPORT == 1)
+
+#if EVENT_READ_STAGING_BUFFER_SIZE > 0
+// Number of 32-bit words of the staging buffer.
+#define STAGING_BUFFER_WORDS    ((uint32_t)EVENT_READ_STAGING_BUFFER_SIZE / (uint32_t)sizeof(uint32_t))
+#endif // EVENT_READ_STAGING_BUFFER_SIZE > 0
+
+// Number of 32-bit words of the pool of the payload buffers.
+#define PAYLOAD_POOL_WORDS      ((uint32_t)EVENT_PAYLOAD_POOL_SIZE / (uint32_t)sizeof(uint32_t))
+
+#if EVENT_LOCK_FREE_QUEUE == 1
+// Number of 32-bit words of the pool of the buffers storing the events and the data of the extended events (one word
+// of each buffer is always left empty).
+#define RING_POOL_WORDS         ((uint32_t)EVENT_QUEUE_POOL_SIZE + PAYLOAD_POOL_WORDS + (uint32_t)EVENT_QUEUE_COUNT)
+
+// Value of a word of the buffer that does not hold a committed event. No event can have this value: it would
+// be an extended event with more data than the buffer can hold.
+#define EVENT_EMPTY_SLOT        0xFFFFFFFFu
+
+#if EVENT_COALESCING_SUPPORT == 1
+// Value of a word of the buffer reserved by an event coalesced after its reservation, skipped by the Java thread. No
+// event can have this value either.
+#define EVENT_SKIPPED_SLOT      0xFFFFFFFEu
+#endif // EVENT_COALESCING_SUPPORT == 1
+#endif // EVENT_LOCK_FREE_QUEUE == 1
+
 // -----------------------------------------------------------------------------
 // Private global variables
 // -----------------------------------------------------------------------------
 
-// Initialize the Message Queues.
-static TX_QUEUE event_queue = { 0 };
+/**
+ * An event queue: a ThreadX queue of 32-bit words for the events and a buffer for the data of the extended events.
+ *
+ * The data of the extended events is stored in payload_buffer, used as a ring buffer of 32-bit words. Only the first
+ * uint32_t of an extended event goes through queue, its data is copied in payload_buffer at once, padded to a multiple
+ * of 4 bytes. Both are read back in the same order.
+ * 	- payload_write_index = the index of the next word to write, only updated by the producers in the critical section.
+ * 	- payload_read_index = the index of the first word not released, only updated by the Java thread.
+ * One word is always left empty to distinguish a full buffer from an empty one.
+ */
+#if EVENT_LOCK_FREE_QUEUE == 1
+/**
+ * With the lock-free backend, the events are not sent through a ThreadX queue: the events and the data of the extended
+ * events are stored together in payload_buffer, used as a multi-producer single-consumer ring buffer of 32-bit words.
+ * 	- payload_write_index = the index following the last reserved word, reserved by the producers with a
+ * 	  compare-and-swap.
+ * 	- payload_read_index = the index of the next event to read, only updated by the Java thread.
+ * A producer reserves the words of its event, copies the data of an extended event, then commits the event by writing
+ * its first word. The Java thread reads the events in the order of the reservations and writes EVENT_EMPTY_SLOT back
+ * in the words it releases.
+ */
+typedef struct {
+	uint32_t* payload_buffer;
+	uint32_t payload_buffer_words;
+	_Atomic uint32_t payload_write_index;
+	volatile uint32_t payload_read_index;
+	// The index of the consumer of the queue in event_consumers.
+	uint8_t consumer;
+#if OFFER_TIMESTAMPS == 1
+	// The offer time of each event, at the index of its first word.
+	uint32_t* timestamps;
+#endif // OFFER_TIMESTAMPS == 1
+} event_queue_t;
+#else
+/**
+ * With the instrumentation or the timestamps, the offer time of each event is stored in timestamps, used as a ring buffer in the order
+ * of the queue. It has one more entry than the queue so that writing the next timestamp before sending the event never
+ * overwrites the timestamp of an event still in the queue.
+ */
+typedef struct {
+	TX_QUEUE queue;
+	uint32_t* payload_buffer;
+	uint32_t payload_buffer_words;
+	volatile uint32_t payload_write_index;
+	volatile uint32_t payload_read_index;
+	// The index of the consumer of the queue in event_consumers.
+	uint8_t consumer;
+#if OFFER_TIMESTAMPS == 1
+	uint32_t* timestamps;
+	uint32_t timestamp_count;
+	uint32_t timestamp_write_index;
+	uint32_t timestamp_read_index;
+#endif // OFFER_TIMESTAMPS == 1
+} event_queue_t;
+#endif // EVENT_LOCK_FREE_QUEUE == 1
+
+// Initialize the Message Queues, indexed by priority: event_queues[EVENT_QUEUE_COUNT - 1] has the highest priority.
 // cppcheck-suppress [misra-c2012-8.9]: Threadx RTOS requires to allocate ThreadX structures and variables in global
 // access, not in the stack.
-static CHAR* event_queue_name = "MICROEJ Event Queue";
+static event_queue_t event_queues[EVENT_QUEUE_COUNT] = { 0 };
+
+// The sizes of the queues, indexed by priority. A size of 0 is replaced by EVENT_QUEUE_SIZE or
+// EVENT_PAYLOAD_BUFFER_SIZE.
+static const uint32_t event_queue_sizes[EVENT_QUEUE_COUNT] = EVENT_QUEUE_SIZES;
+static const uint32_t event_payload_buffer_sizes[EVENT_QUEUE_COUNT] = EVENT_PAYLOAD_BUFFER_SIZES;
+
+/**
+ * The storage of the queues, shared between the queues by LLEVENT_IMPL_initialize() in the order of the priorities.
+ * It can be placed in a dedicated memory with EVENT_STORAGE_ATTRIBUTE.
+ */
+#if EVENT_LOCK_FREE_QUEUE == 1
+EVENT_STORAGE_ATTRIBUTE static uint32_t event_ring_pool[RING_POOL_WORDS];
+#if OFFER_TIMESTAMPS == 1
+EVENT_STORAGE_ATTRIBUTE static uint32_t event_timestamp_pool[RING_POOL_WORDS];
+#endif // OFFER_TIMESTAMPS == 1
+#else
 // cppcheck-suppress [misra-c2012-8.9]: Threadx RTOS requires to allocate ThreadX structures and variables in global
 // access, not in the stack.
-static uint32_t queue_stack[EVENT_QUEUE_SIZE] = { 0 };
-
-// Initialize the mutex used when sending data into event_queue.
-static TX_MUTEX mutex_send_event = { 0 };
+EVENT_STORAGE_ATTRIBUTE static uint32_t event_queue_pool[EVENT_QUEUE_POOL_SIZE];
+EVENT_STORAGE_ATTRIBUTE static uint32_t event_payload_pool[PAYLOAD_POOL_WORDS];
+#if OFFER_TIMESTAMPS == 1
+EVENT_STORAGE_ATTRIBUTE static uint32_t event_timestamp_pool[EVENT_QUEUE_POOL_SIZE + EVENT_QUEUE_COUNT];
+#endif // OFFER_TIMESTAMPS == 1
+#endif // EVENT_LOCK_FREE_QUEUE == 1
+#if EVENT_LOCK_FREE_QUEUE == 0
 // cppcheck-suppress [misra-c2012-8.9]: Threadx RTOS requires to allocate ThreadX structures and variables in global
 // access, not in the stack.
-static CHAR* mutex_queue_name = "Event Queue Mutex";
+static CHAR* event_queue_name = "MICROEJ Event Queue";
+#endif // EVENT_LOCK_FREE_QUEUE == 0
+
+/**
+ * The configuration of an event type:
+ * 	- priority = the index of the queue of the events of this type in event_queues, 0 (the lowest priority) by default.
+ * 	- coalescing = true if an event of this type replaces the previous one still in the queue.
+ * 	- overflow_policy = the LLEVENT_OVERFLOW_* policy applied when the queue is full, LLEVENT_OVERFLOW_REJECT by default.
+ * 	- urgent = true if an event of this type resumes the waiting Java thread at once, without waiting for the batch of
+ * 	  EVENT_WAKEUP_BATCH_SIZE events.
+ * 	- delta_reference = the index + 1 of the references of this type in delta_references, 0 if it has never been
+ * 	  delta-encoded.
+ */
+typedef struct {
+	uint8_t priority;
+	bool coalescing;
+#if EVENT_OVERFLOW_POLICY_SUPPORT == 1
+	uint8_t overflow_policy;
+#endif // EVENT_OVERFLOW_POLICY_SUPPORT == 1
+#if EVENT_WAKEUP_BATCH_SIZE > 1
+	bool urgent;
+#endif // EVENT_WAKEUP_BATCH_SIZE > 1
+#if EVENT_DELTA_TYPE_COUNT > 0
+	uint8_t delta_reference;
+#endif // EVENT_DELTA_TYPE_COUNT > 0
+} event_type_t;
 
-static int32_t waiting_receive_java_thread_id = SNI_ERROR;
+static event_type_t event_types[LLEVENT_FRAMING_MAX_TYPE_ID] = { 0 };
 
+#if EVENT_COALESCING_SUPPORT == 1
 /**
- * Management of the extended event reading:
- * 	- data_length_extended_data = the number of bytes of the extended event.
- * 	- offset_extended_data_read = the number of bytes read by the Java listener.
+ * For each coalescing event type, the last event offered while an event of this type is in a queue, or
+ * COALESCED_EVENT_NONE if there is no event of this type in the queues. When the Java thread fetches the event of this
+ * type from the queue, it returns this one instead.
+ *
+ * With the lock-free backend, a producer sets the event of its type only once it has reserved a word of the queue, so
+ * that an event coalesced with it is never lost when the queue turns out to be full.
+ */
+#if EVENT_LOCK_FREE_QUEUE == 1
+static _Atomic uint32_t coalesced_events[LLEVENT_FRAMING_MAX_TYPE_ID];
+#else
+static volatile uint32_t coalesced_events[LLEVENT_FRAMING_MAX_TYPE_ID];
+#endif // EVENT_LOCK_FREE_QUEUE == 1
+#endif // EVENT_COALESCING_SUPPORT == 1
+
+#if EVENT_TYPE_FILTER_SUPPORT == 1
+/**
+ * The disabled event types, one bit per type: bit (type % 32) of word (type / 32) is set if the events of this type are
+ * discarded by the offers. Written by LLEVENT_IMPL_set_type_enabled(), read by the producers without lock.
+ */
+#if EVENT_LOCK_FREE_QUEUE == 1
+static _Atomic uint32_t disabled_types[(LLEVENT_FRAMING_MAX_TYPE_ID + TYPES_PER_WORD - 1u) / TYPES_PER_WORD];
+#else
+static volatile uint32_t disabled_types[(LLEVENT_FRAMING_MAX_TYPE_ID + TYPES_PER_WORD - 1u) / TYPES_PER_WORD];
+#endif // EVENT_LOCK_FREE_QUEUE == 1
+#endif // EVENT_TYPE_FILTER_SUPPORT == 1
+
+#if EVENT_OVERFLOW_POLICY_SUPPORT == 1
+/**
+ * The number of events of each type lost because their queue was full (see LLEVENT_IMPL_get_type_dropped_events()),
+ * incremented by the producers and by the Java threads.
+ */
+#if EVENT_LOCK_FREE_QUEUE == 1
+static _Atomic uint32_t dropped_type_events[LLEVENT_FRAMING_MAX_TYPE_ID];
+#else
+static volatile uint32_t dropped_type_events[LLEVENT_FRAMING_MAX_TYPE_ID];
+#endif // EVENT_LOCK_FREE_QUEUE == 1
+#endif // EVENT_OVERFLOW_POLICY_SUPPORT == 1
+
+#if EVENT_DELTA_TYPE_COUNT > 0
+/**
+ * The references of a delta-encoded event type:
+ * 	- encoding = true while the extended events of the type are delta-encoded.
+ * 	- offered_length = the number of bytes of offered_data, DELTA_NO_REFERENCE if the next extended event of the type
+ * 	  is stored as is.
+ * 	- offered_data = the data of the last extended event of the type sent to its queue as a reference or as runs,
+ * 	  only used by the producers within the critical section.
+ * 	- decoded_length = the number of bytes of decoded_data, DELTA_NO_REFERENCE if none.
+ * 	- decoded_data = the data of the last extended event of the type fetched as a reference or as runs, only used by
+ * 	  the Java threads. The Java listener reads the extended event from it.
+ */
+typedef struct {
+	bool encoding;
+	uint32_t offered_length;
+	uint32_t offered_data[DELTA_DATA_WORDS];
+	uint32_t decoded_length;
+	uint32_t decoded_data[DELTA_DATA_WORDS];
+} delta_reference_t;
+
+static delta_reference_t delta_references[EVENT_DELTA_TYPE_COUNT];
+
+// The number of references of delta_references given to a type, only updated within the critical section.
+static uint32_t delta_reference_count = 0;
+
+// The runs of the extended event being offered, only used within the critical section.
+static uint32_t delta_encoding_buffer[DELTA_DATA_WORDS];
+
+// The runs of the extended event being decoded, only used by the Java threads, which run the natives one at a time.
+static uint32_t delta_decoding_buffer[DELTA_DATA_WORDS];
+#endif // EVENT_DELTA_TYPE_COUNT > 0
+
+/**
+ * The data of a mapped extended event, stored in the payload buffer in place of the data: the data stays in the buffer
+ * of the producer until release is called with release_arg, once the Java listener ends the read.
  */
-static uint32_t data_length_extended_data;
-static uint32_t offset_extended_data_read;
+typedef struct {
+	const uint8_t* data;
+	LLEVENT_release_callback_t release;
+	void* release_arg;
+} mapped_data_t;
 
 /**
+ * The state of the read of an extended event by a consumer, selected once by each function reading the data of an
+ * extended event (see get_reader()) and given to the functions it calls.
+ * 	- reading_queue = the queue of the extended event being read.
+ * The words of the extended event being read in the payload buffer of reading_queue are released at once when the Java
+ * listener ends the read:
+ * 	- payload_event_read_index = the index of the next word to read.
+ * 	- payload_event_end_index = the index following the last word.
+ * 	- payload_event_release_index = the index following the last word of the event in the payload buffer.
+ * For a mapped extended event or a decoded delta-encoded extended event, the read and end indexes are word indexes in
+ * the data of reading_mapped_data instead, without wrap.
+ * 	- reading_mapped_data = the data of the mapped extended event being read, or the decoded data of the
+ * 	  delta-encoded extended event being read with no release function. Its data is NULL if the extended event being
+ * 	  read is read from the payload buffer.
+ * Management of the extended event reading:
+ * 	- data_length_extended_data = the number of bytes of the extended event.
+ * 	- offset_extended_data_read = the number of bytes read by the Java listener.
  * Management of the bytes remaining after getting an uint32_t (4 bytes buffer) from the queue:
  * 	- buffer_extended_data = the bytes remaining from the 4 bytes buffer read in the queue.
  * 	- offset_buffer_extended_data = The number of bytes already read from buffer_extended_data.
  * 									-1 if the buffer_extended_data is empty.
+ * Management of the extended data copied at once when the Java listener starts to read it:
+ * 	- staging_buffer = the words of the extended event being read, the bytes at offset_extended_data_read onwards
+ * 	  remaining to be read.
+ * 	- staged_words = the number of words in staging_buffer, 0 if the extended event being read is not staged.
+ * A value to know if it is 4th or 8 bytes aligned.
+ * 	- data_alignment = 0 -> 4 bytes aligned, 1 -> 8 bytes aligned.
+ * 	- event_timestamp = the offer time of the event fetched last (see LLEVENT_IMPL_get_event_timestamp()).
+ */
+typedef struct {
+	event_queue_t* reading_queue;
+	uint32_t payload_event_read_index;
+	uint32_t payload_event_end_index;
+	uint32_t payload_event_release_index;
+#if (EVENT_MAPPED_DATA_SUPPORT == 1) || (EVENT_DELTA_TYPE_COUNT > 0)
+	mapped_data_t reading_mapped_data;
+#endif // (EVENT_MAPPED_DATA_SUPPORT == 1) || (EVENT_DELTA_TYPE_COUNT > 0)
+	uint32_t data_length_extended_data;
+	uint32_t offset_extended_data_read;
+	uint32_t buffer_extended_data;
+	int8_t offset_buffer_extended_data;
+#if EVENT_READ_STAGING_BUFFER_SIZE > 0
+	uint32_t staging_buffer[STAGING_BUFFER_WORDS];
+	uint32_t staged_words;
+#endif // EVENT_READ_STAGING_BUFFER_SIZE > 0
+	uint8_t data_alignment;
+#if EVENT_TIMESTAMP_SUPPORT == 1
+	uint32_t event_timestamp;
+#endif // EVENT_TIMESTAMP_SUPPORT == 1
+} event_reader_t;
+
+/**
+ * A consumer of the events: a Java thread waiting for the events of the queues given to it by EVENT_QUEUE_CONSUMERS and
+ * reading their data.
+ * 	- waiting_receive_java_thread_id = the Java thread waiting for an event, SNI_ERROR if there is none.
+ * 	- reader_java_thread_id = the Java thread that waited last, whose reads of extended data use reader.
+ * 	- wakeup_pending_events = the number of events offered since the Java thread started to wait.
+ * 	- wakeup_timer = the timer that resumes the waiting Java thread EVENT_WAKEUP_DELAY ticks after the first event
+ * 	  offered.
+ * 	- deferred_resume_java_thread_id = the Java thread to resume by the wakeup thread, SNI_ERROR if there is none.
+ * 	- timed_wait_suspended = true while the Java thread is suspended by a wait with a timeout, until the wait function
+ * 	  is called again once the Java thread is resumed.
+ * 	- reader = the state of the read of the extended event fetched last.
  */
-static uint32_t buffer_extended_data;
-static int8_t offset_buffer_extended_data;
+typedef struct {
+#if EVENT_LOCK_FREE_QUEUE == 1
+	_Atomic int32_t waiting_receive_java_thread_id;
+#else
+	volatile int32_t waiting_receive_java_thread_id;
+#endif // EVENT_LOCK_FREE_QUEUE == 1
+	int32_t reader_java_thread_id;
+#if EVENT_WAKEUP_BATCH_SIZE > 1
+#if EVENT_LOCK_FREE_QUEUE == 1
+	_Atomic uint32_t wakeup_pending_events;
+#else
+	volatile uint32_t wakeup_pending_events;
+#endif // EVENT_LOCK_FREE_QUEUE == 1
+	TX_TIMER wakeup_timer;
+#endif // EVENT_WAKEUP_BATCH_SIZE > 1
+#if EVENT_ISR_SUPPORT == 1
+	volatile int32_t deferred_resume_java_thread_id;
+#endif // EVENT_ISR_SUPPORT == 1
+	bool timed_wait_suspended;
+	event_reader_t reader;
+} event_consumer_t;
+
+// The consumers, indexed by the values of EVENT_QUEUE_CONSUMERS. Consumer 0 waits with LLEVENT_IMPL_wait_event().
+// cppcheck-suppress [misra-c2012-8.9]: Threadx RTOS requires to allocate ThreadX structures and variables in global
+// access, not in the stack.
+static event_consumer_t event_consumers[EVENT_CONSUMER_COUNT] = { 0 };
+
+// The consumer of the queue of each priority.
+static const uint8_t event_queue_consumers[EVENT_QUEUE_COUNT] = EVENT_QUEUE_CONSUMERS;
+
+#if EVENT_ISR_SUPPORT == 1
+// Initialize the semaphore used by an interrupt handler to request the resume of the waiting Java thread.
+static TX_SEMAPHORE wakeup_semaphore = { 0 };
+// cppcheck-suppress [misra-c2012-8.9]: Threadx RTOS requires to allocate ThreadX structures and variables in global
+// access, not in the stack.
+static CHAR* wakeup_semaphore_name = "Event Wakeup Semaphore";
+
+// Initialize the thread that resumes the waiting Java thread on behalf of an interrupt handler.
+static TX_THREAD wakeup_thread = { 0 };
+// cppcheck-suppress [misra-c2012-8.9]: Threadx RTOS requires to allocate ThreadX structures and variables in global
+// access, not in the stack.
+static CHAR* wakeup_thread_name = "MICROEJ Event Wakeup";
+// cppcheck-suppress [misra-c2012-8.9]: Threadx RTOS requires to allocate ThreadX structures and variables in global
+// access, not in the stack.
+static ULONG wakeup_thread_stack[EVENT_WAKEUP_THREAD_STACK_SIZE / sizeof(ULONG)] = { 0 };
+#elif EVENT_LOCK_FREE_QUEUE == 0
+// Initialize the mutex used when sending data into the event queues.
+static TX_MUTEX mutex_send_event = { 0 };
+// cppcheck-suppress [misra-c2012-8.9]: Threadx RTOS requires to allocate ThreadX structures and variables in global
+// access, not in the stack.
+static CHAR* mutex_queue_name = "Event Queue Mutex";
+#endif // EVENT_ISR_SUPPORT == 1
+
+#if EVENT_WAKEUP_BATCH_SIZE > 1
+// The name of the timers that resume the waiting Java threads EVENT_WAKEUP_DELAY ticks after the first event offered.
+// cppcheck-suppress [misra-c2012-8.9]: Threadx RTOS requires to allocate ThreadX structures and variables in global
+// access, not in the stack.
+static CHAR* wakeup_timer_name = "MICROEJ Event Wakeup Timer";
+#endif // EVENT_WAKEUP_BATCH_SIZE > 1
+
+#if EVENT_BLOCKING_OFFER_SUPPORT == 1
+// Initialize the semaphore given by the Java thread when it frees space in a queue while producers are blocked.
+static TX_SEMAPHORE space_semaphore = { 0 };
+// cppcheck-suppress [misra-c2012-8.9]: Threadx RTOS requires to allocate ThreadX structures and variables in global
+// access, not in the stack.
+static CHAR* space_semaphore_name = "Event Space Semaphore";
+
+// The number of producers blocked until space is available in a queue.
+#if EVENT_LOCK_FREE_QUEUE == 1
+static _Atomic uint32_t blocked_producers = 0;
+#else
+static volatile uint32_t blocked_producers = 0;
+#endif // EVENT_LOCK_FREE_QUEUE == 1
+#endif // EVENT_BLOCKING_OFFER_SUPPORT == 1
+
+#if EVENT_PRODUCER_LANE_COUNT > 0
+// The producer lanes, empty until they are registered with LLEVENT_IMPL_register_producer_lane().
+static LLEVENT_amp_ring_t producer_lanes[EVENT_PRODUCER_LANE_COUNT];
+
+// The number of registered producer lanes, the first lanes of producer_lanes.
+static _Atomic uint32_t registered_producer_lanes = 0;
+
+// The write index of each lane when its events were last moved into the queues, only used by the Java threads.
+static uint32_t moved_lane_write_indexes[EVENT_PRODUCER_LANE_COUNT] = { 0 };
+
+// The lane whose events are moved first the next time, only used by the Java threads.
+static uint32_t first_moved_lane = 0;
+#endif // EVENT_PRODUCER_LANE_COUNT > 0
+
+#if EVENT_OVERFLOW_POLICY_SUPPORT == 1
+// The events spilled while their queue is full, written by the producers with the interrupts disabled and moved into
+// the queues by the Java threads.
+static LLEVENT_amp_ring_t overflow_ring;
+
+// The write index of the overflow ring when its events were last moved into the queues, only used by the Java threads.
+static uint32_t moved_overflow_write_index = 0;
+
+// Whether the event at the head of the overflow ring is being moved into its queue by a Java thread, so that the
+// producers do not discard it. Accessed with the interrupts disabled.
+static volatile bool overflow_event_moving = false;
+#endif // EVENT_OVERFLOW_POLICY_SUPPORT == 1
+
+
+// -----------------------------------------------------------------------------
+// Private function definition
+// -----------------------------------------------------------------------------
+
+#if EVENT_ISR_SUPPORT == 1
 
 /**
- * Long value is 64 bits and is build from 2 uint32_t. (@see LLEVENT_IMPL_readLong)
- *  - first_long_value = store the first uint32_t read from the event_queue.
+ * Enters the critical section protecting the event queues by disabling the interrupts.
+ *
+ * @return the previous interrupt posture, to give to event_queue_unlock().
  */
-static uint32_t first_long_value;
+static UINT event_queue_lock(void) {
+	return tx_interrupt_control(TX_INT_DISABLE);
+}
 
 /**
- * A counter to remember how many bytes have been skipped. (@see LLEVENT_IMPL_skipBytes)
+ * Leaves the critical section protecting the event queues by restoring the interrupt posture.
+ *
+ * @param lock_state the value returned by event_queue_lock().
  */
-static uint32_t skip_bytes_counter;
+static void event_queue_unlock(UINT lock_state) {
+	// Unused return value: the previous posture is the one set by event_queue_lock().
+	UINT previous_posture = tx_interrupt_control(lock_state);
+	(void)previous_posture;
+}
 
 /**
- * A static value to know if it is 4th or 8 bytes aligned.
- * If 0 -> 4 bytes aligned.
- * If 1 -> 8 bytes aligned.
+ * Entry point of the thread that resumes the waiting Java threads on behalf of the interrupt handlers.
  */
-static uint8_t data_alignment;
+static VOID wakeup_thread_entry(ULONG input) {
+	(void)input;
+	for (;;) {
+		UINT status = tx_semaphore_get(&wakeup_semaphore, TX_WAIT_FOREVER);
+		if (TX_SUCCESS == status) {
+			for (uint32_t i = 0; i < (uint32_t)EVENT_CONSUMER_COUNT; i++) {
+				event_consumer_t* consumer = &event_consumers[i];
+				UINT lock_state = event_queue_lock();
+				int32_t java_thread_id = consumer->deferred_resume_java_thread_id;
+				consumer->deferred_resume_java_thread_id = SNI_ERROR;
+				event_queue_unlock(lock_state);
 
-// -----------------------------------------------------------------------------
-// Public function definition
-// -----------------------------------------------------------------------------
+				if ((java_thread_id != SNI_ERROR) && (SNI_resumeJavaThread(java_thread_id) == SNI_ERROR)) {
+					// Java thread ID is invalid.
+					LLEVENT_ERROR_TRACE(
+						"while trying to resume the EventQueue waiting thread: The Java Thread ID is invalid, can't resume the Event Queue waiting thread.\n");
+				}
+			}
+		} else {
+			LLEVENT_ERROR_TRACE("during attempt to take the wakeup semaphore ; status = 0x%x \n", status);
+		}
+	}
+}
+
+#elif EVENT_LOCK_FREE_QUEUE == 0
 
 /**
- * Starts the event pump.
+ * Enters the critical section protecting the event queues by taking the mutex.
+ *
+ * @return an unused lock state, to give to event_queue_unlock().
  */
-void LLEVENT_IMPL_initialize(void) {
-	// the size of messages is in 32-bit words, so 1 here.
-	UINT queue_status = tx_queue_create(&event_queue, event_queue_name, 1, &queue_stack[0], EVENT_QUEUE_SIZE);
-	UINT mutex_status = tx_mutex_create(&mutex_send_event, mutex_queue_name, TX_NO_INHERIT);
-	if ((TX_SUCCESS != queue_status) || (TX_SUCCESS != mutex_status)) {
-		if (SNI_throwNativeIOException(EVENT_NOK, "Not enough memory to allocate the queue.") == SNI_ERROR) {
-			LLEVENT_ERROR_TRACE("during EventQueue.getInstance(): Not enough memory to allocate the queue.\n");
-			LLEVENT_ERROR_TRACE(
-				"This function is not called within the virtual machine task or if the current thread is suspended.\n");
-			LLEVENT_ERROR_TRACE("queue_status = 0x%x ; mutex_status = 0x%x \n", queue_status, mutex_status);
+static UINT event_queue_lock(void) {
+#if EVENT_INSTRUMENTATION == 1
+	// Try first without waiting to detect the contention.
+	UINT status = tx_mutex_get(&mutex_send_event, TX_NO_WAIT);
+	if (TX_NOT_AVAILABLE == status) {
+		uint32_t start_time = EVENT_TIMESTAMP();
+		status = tx_mutex_get(&mutex_send_event, TX_WAIT_FOREVER);
+		if (TX_SUCCESS == status) {
+			LLEVENT_STATISTICS_record_contention(EVENT_TIMESTAMP() - start_time);
 		}
 	}
-	data_length_extended_data = 0;
-	offset_extended_data_read = 0;
+#else
+	UINT status = tx_mutex_get(&mutex_send_event, TX_WAIT_FOREVER);
+#endif // EVENT_INSTRUMENTATION == 1
+	if (TX_SUCCESS != status) {
+		LLEVENT_ERROR_TRACE("during attempt to take the mutex ; status = 0x%x \n", status);
+	}
+	return status;
+}
+
+/**
+ * Leaves the critical section protecting the event queues by releasing the mutex.
+ *
+ * @param lock_state the value returned by event_queue_lock().
+ */
+static void event_queue_unlock(UINT lock_state) {
+	(void)lock_state;
+	UINT status = tx_mutex_put(&mutex_send_event);
+	if (TX_SUCCESS != status) {
+		LLEVENT_ERROR_TRACE("during attempt to release the mutex ; status = 0x%x \n", status);
+	}
+}
 
-	buffer_extended_data = (uint32_t)NULL;
-	offset_buffer_extended_data = -1;
+#endif // EVENT_ISR_SUPPORT == 1
 
-	first_long_value = 0;
+/**
+ * Gets the Java thread of a consumer waiting for an event and forgets it, so that it is resumed only once.
+ * Must be called within the critical section protecting the event queues, or after the event is committed with the
+ * lock-free backend.
+ *
+ * @return the ID of the waiting Java thread, SNI_ERROR if there is none.
+ */
+static int32_t take_waiting_java_thread(event_consumer_t* consumer) {
+#if EVENT_LOCK_FREE_QUEUE == 1
+	return atomic_exchange(&consumer->waiting_receive_java_thread_id, SNI_ERROR);
+#else
+	int32_t java_thread_id = consumer->waiting_receive_java_thread_id;
+	consumer->waiting_receive_java_thread_id = SNI_ERROR;
+	return java_thread_id;
+#endif // EVENT_LOCK_FREE_QUEUE == 1
+}
 
-	skip_bytes_counter = 0;
+/**
+ * Checks whether the events of a type resume the waiting Java thread at once (see LLEVENT_IMPL_set_type_urgent()).
+ * All the types are urgent when the wakeups are not batched.
+ */
+static inline bool is_type_urgent(uint32_t type) {
+#if EVENT_WAKEUP_BATCH_SIZE > 1
+	return event_types[type].urgent;
+#else
+	(void)type;
+	return true;
+#endif // EVENT_WAKEUP_BATCH_SIZE > 1
 }
 
 /**
- * Offers an event to the queue.
+ * Gets the Java thread to resume once events have been offered and forgets it. Same constraints as
+ * take_waiting_java_thread().
  *
- * @param type the type of the event.
- * @param data the data of the event.
- * @return true if the message has been sent, false otherwise.
+ * When EVENT_WAKEUP_BATCH_SIZE is higher than 1, the Java thread is returned only once EVENT_WAKEUP_BATCH_SIZE events
+ * have been offered since it started to wait, or at once for an urgent event. The first deferrable event starts the
+ * wakeup timer that resumes it otherwise, so that a burst of events costs a single wakeup.
+ *
+ * @param events the number of events offered, at least 1.
+ * @param urgent true if one of the events is of an urgent type (see is_type_urgent()).
+ * @return the ID of the Java thread to resume, SNI_ERROR if there is none.
  */
-bool LLEVENT_IMPL_offer_event(uint32_t type, uint32_t data) {
-	// The boolean to return at the end of the method.
-	jboolean offer_status = JTRUE;
-	// Create the message from the type and the data.
-	// Make sure that the first bit is 0 because it is not an extended event.
-	uint32_t event_message = ((type << (uint32_t)24) | data) & ((uint32_t)0x7FFFFFFF);
+static int32_t take_java_thread_to_wake(event_consumer_t* consumer, uint32_t events, bool urgent) {
+#if EVENT_WAKEUP_BATCH_SIZE > 1
+	int32_t java_thread_id = SNI_ERROR;
+#if EVENT_LOCK_FREE_QUEUE == 1
+	uint32_t pending_events = atomic_fetch_add(&consumer->wakeup_pending_events, events) + events;
+#else
+	uint32_t pending_events = consumer->wakeup_pending_events + events;
+	consumer->wakeup_pending_events = pending_events;
+#endif // EVENT_LOCK_FREE_QUEUE == 1
+	if (urgent || (pending_events >= (uint32_t)EVENT_WAKEUP_BATCH_SIZE)) {
+		java_thread_id = take_waiting_java_thread(consumer);
+	} else if (events == pending_events) {
+		// Unused return values: a timer still active for a previous burst only resumes the Java thread earlier.
+		UINT status = tx_timer_deactivate(&consumer->wakeup_timer);
+		(void)status;
+		status = tx_timer_change(&consumer->wakeup_timer, (ULONG)EVENT_WAKEUP_DELAY, 0);
+		(void)status;
+		status = tx_timer_activate(&consumer->wakeup_timer);
+		(void)status;
+	} else {
+		// The wakeup timer is already started.
+	}
+	return java_thread_id;
+#else
+	(void)events;
+	(void)urgent;
+	return take_waiting_java_thread(consumer);
+#endif // EVENT_WAKEUP_BATCH_SIZE > 1
+}
 
-	// Take the mutex before sending the event.
-	UINT status = tx_mutex_get(&mutex_send_event, TX_WAIT_FOREVER);
-	if (TX_SUCCESS != status) {
-		LLEVENT_ERROR_TRACE("during attempt to take the mutex ; status = 0x%x \n", status);
+/**
+ * Registers the current Java thread as the thread of a consumer waiting for an event, before it checks the queues.
+ */
+static void set_waiting_java_thread(event_consumer_t* consumer) {
+#if EVENT_WAKEUP_BATCH_SIZE > 1
+#if EVENT_LOCK_FREE_QUEUE == 1
+	atomic_store(&consumer->wakeup_pending_events, 0u);
+#else
+	// Not interleaved with the update of a producer, that could not start the wakeup timer otherwise.
+	UINT lock_state = event_queue_lock();
+	consumer->wakeup_pending_events = 0;
+	event_queue_unlock(lock_state);
+#endif // EVENT_LOCK_FREE_QUEUE == 1
+#endif // EVENT_WAKEUP_BATCH_SIZE > 1
+	int32_t java_thread_id = SNI_getCurrentJavaThreadID();
+#if EVENT_CONSUMER_COUNT > 1
+	// A Java thread reads with the reader of the consumer it waited on last only.
+	for (uint32_t i = 0; i < (uint32_t)EVENT_CONSUMER_COUNT; i++) {
+		if (event_consumers[i].reader_java_thread_id == java_thread_id) {
+			event_consumers[i].reader_java_thread_id = SNI_ERROR;
+		}
 	}
+#endif // EVENT_CONSUMER_COUNT > 1
+	// The data of the extended event it fetches is read with the reader of this consumer.
+	consumer->reader_java_thread_id = java_thread_id;
+	consumer->waiting_receive_java_thread_id = java_thread_id;
+}
 
-	// Send the event into the queue, no wait since the queue should be available.
-	status = tx_queue_send(&event_queue, &event_message, TX_NO_WAIT);
-	if (TX_SUCCESS != status) {
-		LLEVENT_ERROR_TRACE("during tx_queue_send ; status = 0x%x \n", status);
-		offer_status = JFALSE;
+/**
+ * Gets the reader of the consumer of the calling Java thread: the consumer it last waited on, consumer 0 if none.
+ * Called once by each function reading the data of an extended event, which gives the reader to the functions it calls.
+ */
+static inline event_reader_t* get_reader(void) {
+	event_reader_t* selected_reader = &event_consumers[0].reader;
+#if EVENT_CONSUMER_COUNT > 1
+	int32_t java_thread_id = SNI_getCurrentJavaThreadID();
+	for (uint32_t i = 0; i < (uint32_t)EVENT_CONSUMER_COUNT; i++) {
+		if (event_consumers[i].reader_java_thread_id == java_thread_id) {
+			selected_reader = &event_consumers[i].reader;
+		}
 	}
+#endif // EVENT_CONSUMER_COUNT > 1
+	return selected_reader;
+}
+
+/**
+ * Gets the number of bytes of the extended event being read that remain to be read.
+ */
+static inline uint32_t get_available_bytes(const event_reader_t* reader) {
+	return reader->data_length_extended_data - reader->offset_extended_data_read;
+}
 
-	// If a Java thread is waiting to read an event, notify it.
-	if ((waiting_receive_java_thread_id != SNI_ERROR) && (offer_status == (jboolean)JTRUE)) {
-		if (SNI_resumeJavaThread(waiting_receive_java_thread_id) == SNI_ERROR) {
+/**
+ * Resumes the Java thread of a consumer waiting for an event. Must be called outside the critical section protecting the
+ * event queues.
+ *
+ * @param java_thread_id the value returned by take_waiting_java_thread().
+ * @param from_isr true if the caller is an interrupt handler: the resume is then deferred to the wakeup thread.
+ */
+static void resume_waiting_java_thread(event_consumer_t* consumer, int32_t java_thread_id, bool from_isr) {
+	if (java_thread_id != SNI_ERROR) {
+		LLEVENT_TRACE_RECORD(LLEVENT_TRACE_EVENT_RESUME, java_thread_id, (uint32_t)(consumer - &event_consumers[0]));
+#if EVENT_ISR_SUPPORT == 1
+		if (from_isr) {
+			consumer->deferred_resume_java_thread_id = java_thread_id;
+			// Unused return value: the semaphore is already set if the wakeup thread has not run yet.
+			UINT status = tx_semaphore_ceiling_put(&wakeup_semaphore, 1);
+			(void)status;
+		} else
+#else
+		(void)consumer;
+		(void)from_isr;
+#endif // EVENT_ISR_SUPPORT == 1
+		if (SNI_resumeJavaThread(java_thread_id) == SNI_ERROR) {
 			// Java thread ID is invalid.
 			LLEVENT_ERROR_TRACE(
 				"while trying to resume the EventQueue waiting thread: The Java Thread ID is invalid, can't resume the Event Queue waiting thread.\n");
-			waiting_receive_java_thread_id = SNI_ERROR;
-		} else {
-			waiting_receive_java_thread_id = SNI_ERROR;
 		}
 	}
+}
 
-	// Free the mutex after sending the event.
-	status = tx_mutex_put(&mutex_send_event);
-	if (TX_SUCCESS != status) {
-		LLEVENT_ERROR_TRACE("during attempt to release the mutex ; status = 0x%x \n", status);
-	}
+#if (EVENT_WAKEUP_BATCH_SIZE > 1) || (EVENT_PRODUCER_LANE_COUNT > 0) || (EVENT_OVERFLOW_POLICY_SUPPORT == 1)
 
-	return offer_status;
+/**
+ * Gets the Java thread of a consumer waiting for an event and forgets it, outside the critical section protecting the
+ * event queues: from the wakeup timer, which cannot wait for the mutex, from a producer lane or from a spill into the
+ * overflow ring.
+ *
+ * @return the ID of the waiting Java thread, SNI_ERROR if there is none.
+ */
+static int32_t take_waiting_java_thread_without_lock(event_consumer_t* consumer) {
+#if EVENT_LOCK_FREE_QUEUE == 1
+	return take_waiting_java_thread(consumer);
+#else
+	// Take the Java thread with the interrupts disabled. A producer interrupted while taking it may resume the Java
+	// thread once more, which only makes it check the queues again.
+	UINT interrupt_state = tx_interrupt_control(TX_INT_DISABLE);
+	int32_t java_thread_id = take_waiting_java_thread(consumer);
+	(void)tx_interrupt_control(interrupt_state);
+	return java_thread_id;
+#endif // EVENT_LOCK_FREE_QUEUE == 1
 }
 
+#endif // (EVENT_WAKEUP_BATCH_SIZE > 1) || (EVENT_PRODUCER_LANE_COUNT > 0) || (EVENT_OVERFLOW_POLICY_SUPPORT == 1)
+
+#if EVENT_WAKEUP_BATCH_SIZE > 1
+
 /**
- * Offers an extended event to the queue.
+ * Resumes the waiting Java thread EVENT_WAKEUP_DELAY ticks after the first event of a burst.
+ * Runs in the ThreadX timer thread, or in the timer interrupt with TX_TIMER_PROCESS_IN_ISR.
+ */
+static VOID wakeup_timer_expiration(ULONG input) {
+	// The input is the index of the consumer.
+	event_consumer_t* consumer = &event_consumers[input];
+	int32_t java_thread_id = take_waiting_java_thread_without_lock(consumer);
+#ifdef TX_TIMER_PROCESS_IN_ISR
+	resume_waiting_java_thread(consumer, java_thread_id, true);
+#else
+	resume_waiting_java_thread(consumer, java_thread_id, false);
+#endif // TX_TIMER_PROCESS_IN_ISR
+}
+
+#endif // EVENT_WAKEUP_BATCH_SIZE > 1
+
+#if EVENT_TYPE_FILTER_SUPPORT == 1
+
+/**
+ * Checks whether the events of a type are discarded, before any lock is taken: a single bit test when the type is
+ * enabled.
  *
  * @param type the type of the event.
- * @param data the data of the event.
- * @return true if the message has been sent, false otherwise.
+ * @return true if the type is disabled and the event must be discarded.
  */
-bool LLEVENT_IMPL_offer_extended_event(uint32_t type, const void* data, uint32_t data_length) {
-	// The boolean to return at the end of the method.
-	jboolean offer_status = JTRUE;
-	// Create the first uint32_t of the extended event that contain the type and the data length (number of bytes).
-	uint32_t event_message = ((uint32_t)0x1 << (uint32_t)31) | (type << (uint32_t)24) | data_length;
+static bool is_event_filtered(uint32_t type) {
+	uint32_t type_bit = (uint32_t)1u << (type % TYPES_PER_WORD);
+#if EVENT_LOCK_FREE_QUEUE == 1
+	bool filtered = (atomic_load_explicit(&disabled_types[type / TYPES_PER_WORD], memory_order_relaxed) & type_bit) != 0u;
+#else
+	bool filtered = (disabled_types[type / TYPES_PER_WORD] & type_bit) != 0u;
+#endif // EVENT_LOCK_FREE_QUEUE == 1
+#if EVENT_INSTRUMENTATION == 1
+	if (filtered) {
+#if EVENT_LOCK_FREE_QUEUE == 1
+		LLEVENT_STATISTICS_record_filtered(type);
+#else
+		UINT lock_state = event_queue_lock();
+		LLEVENT_STATISTICS_record_filtered(type);
+		event_queue_unlock(lock_state);
+#endif // EVENT_LOCK_FREE_QUEUE == 1
+	}
+#endif // EVENT_INSTRUMENTATION == 1
+	return filtered;
+}
 
-	// Convert the data.
-	// cppcheck-suppress [misra-c2012-11.5]: conversion from void* to int32_t* necessary to send the input data through
-	// the queue.
-	const int32_t* event_data = (const int32_t*)data;
+#else
+
+/**
+ * No event is discarded without type filtering.
+ */
+static bool is_event_filtered(uint32_t type) {
+	(void)type;
+	return false;
+}
 
-	// Get the number of data messages to send in the event queue -> Number of bytes / sizeof(int) rounded up.
-	int data_length_int = (int)ceil((double)(data_length / (double)sizeof(int)));
+#endif // EVENT_TYPE_FILTER_SUPPORT == 1
 
-	// Take the mutex before sending the extended event.
-	UINT status = tx_mutex_get(&mutex_send_event, TX_WAIT_FOREVER);
-	if (TX_SUCCESS != status) {
-		LLEVENT_ERROR_TRACE("during attempt to take the mutex ; status = 0x%x \n", status);
+#if EVENT_OVERFLOW_POLICY_SUPPORT == 1
+
+/**
+ * Counts an event lost because its queue was full, from a producer or from a Java thread.
+ *
+ * @param type the type of the event.
+ */
+static void count_dropped_event(uint32_t type) {
+#if EVENT_LOCK_FREE_QUEUE == 1
+	(void)atomic_fetch_add_explicit(&dropped_type_events[type], 1u, memory_order_relaxed);
+#else
+	// Not interleaved with the increment of an interrupt handler.
+	UINT interrupt_state = tx_interrupt_control(TX_INT_DISABLE);
+	dropped_type_events[type]++;
+	(void)tx_interrupt_control(interrupt_state);
+#endif // EVENT_LOCK_FREE_QUEUE == 1
+}
+
+/**
+ * Counts the events of a batch that have not been discarded, lost because their queue was full.
+ */
+static void count_dropped_batch(const LLEVENT_batch_event_t* events, uint32_t count, uint32_t kept_events) {
+	for (uint32_t i = 0; i < count; i++) {
+		if ((kept_events & ((uint32_t)1u << i)) != 0u) {
+			count_dropped_event((uint32_t)events[i].type);
+		}
 	}
+}
 
-	// Check that there is enough space in the queue to send the extended data.
-	ULONG available_storage;
-	status = tx_queue_info_get(&event_queue, TX_NULL, TX_NULL, &available_storage, TX_NULL, TX_NULL, TX_NULL);
-	if (TX_SUCCESS != status) {
-		LLEVENT_ERROR_TRACE("after call of tx_queue_info_get; status = 0x%x \n", status);
+#endif // EVENT_OVERFLOW_POLICY_SUPPORT == 1
+
+/**
+ * Filters the events of a batch once, so that the batch is sized and written with the same filter even if a type is
+ * enabled or disabled in the meantime.
+ *
+ * @param events the events of the batch.
+ * @param count the number of events, at most LLEVENT_BATCH_MAX_EVENTS.
+ * @return the mask of the events to offer, bit i for events[i].
+ */
+static uint32_t filter_batch_events(const LLEVENT_batch_event_t* events, uint32_t count) {
+	uint32_t kept_events = 0;
+	for (uint32_t i = 0; i < count; i++) {
+		if (!is_event_filtered((uint32_t)events[i].type)) {
+			kept_events |= (uint32_t)1u << i;
+		}
 	}
+	return kept_events;
+}
 
-	if (available_storage < (data_length_int + 1)) {
-		offer_status = JFALSE;
+/**
+ * Gets the first word of an event of a batch.
+ */
+static uint32_t get_batch_event_message(const LLEVENT_batch_event_t* event) {
+	return (NULL != event->extended_data) ?
+	       LLEVENT_FRAMING_extended_event((uint32_t)event->type, (uint32_t)event->data) :
+	       LLEVENT_FRAMING_simple_event((uint32_t)event->type, (uint32_t)event->data);
+}
+
+/**
+ * Checks whether one of the events of a batch that have not been discarded is of an urgent type.
+ */
+static bool is_batch_urgent(const LLEVENT_batch_event_t* events, uint32_t count, uint32_t kept_events) {
+	bool urgent = false;
+	for (uint32_t i = 0; (i < count) && !urgent; i++) {
+		urgent = ((kept_events & ((uint32_t)1u << i)) != 0u) && is_type_urgent((uint32_t)events[i].type);
 	}
+	return urgent;
+}
 
-	// Send the first part of the event in the queue.
-	if (offer_status == (jboolean)JTRUE) {
-		status = tx_queue_send(&event_queue, &event_message, TX_NO_WAIT);
-		if (TX_SUCCESS != status) {
-			LLEVENT_ERROR_TRACE("during tx_queue_send ; status = 0x%x \n", status);
-			offer_status = JFALSE;
+#if EVENT_INSTRUMENTATION == 1
+
+/**
+ * Records the offer of the events of a batch that have not been discarded.
+ */
+static void record_batch_offer(const LLEVENT_batch_event_t* events, uint32_t count, uint32_t kept_events,
+                               bool offer_status) {
+	for (uint32_t i = 0; i < count; i++) {
+		if ((kept_events & ((uint32_t)1u << i)) != 0u) {
+			LLEVENT_STATISTICS_record_offer((uint32_t)events[i].type, offer_status);
 		}
 	}
+}
 
-	// Send the data of the extended event through the queue.
-	if (offer_status == (jboolean)JTRUE) {
-		for (int i = 0; i < data_length_int; i++) {
-			// cppcheck-suppress [misra-c2012-11.8]: The ThreadX API prevents the use of the const keyword for the
-			// pointer type cast.
-			status = tx_queue_send(&event_queue, (void*)&event_data[i], TX_NO_WAIT);
-			if (TX_SUCCESS != status) {
-				LLEVENT_ERROR_TRACE("during tx_queue_send ; status = 0x%x \n", status);
-				offer_status = JFALSE;
-			}
-		}
+#endif // EVENT_INSTRUMENTATION == 1
+
+#if EVENT_BLOCKING_OFFER_SUPPORT == 1
+
+/**
+ * Wakes up a blocked producer, if any, to retry its offer. Called by the Java thread when it frees space in a queue,
+ * and by a blocked producer once its offer is done so that another one retries.
+ */
+static void notify_space_available(void) {
+#if EVENT_LOCK_FREE_QUEUE == 1
+	uint32_t producers = atomic_load(&blocked_producers);
+#else
+	uint32_t producers = blocked_producers;
+#endif // EVENT_LOCK_FREE_QUEUE == 1
+	if (0u != producers) {
+		// Unused return value: the semaphore is already set if no blocked producer has run yet.
+		UINT status = tx_semaphore_ceiling_put(&space_semaphore, 1);
+		(void)status;
 	}
+}
 
-	// If a Java thread is waiting to read an event, notify it.
-	if (waiting_receive_java_thread_id != SNI_ERROR) {
-		if (SNI_resumeJavaThread(waiting_receive_java_thread_id) == SNI_ERROR) {
-			// Java thread ID is invalid.
+/**
+ * Registers or unregisters a producer blocked until space is available in a queue. A producer retries its offer once
+ * registered, so that a space freed meanwhile is notified.
+ *
+ * @param blocked true to register the producer, false to unregister it.
+ */
+static void set_producer_blocked(bool blocked) {
+#if EVENT_LOCK_FREE_QUEUE == 1
+	if (blocked) {
+		(void)atomic_fetch_add(&blocked_producers, 1u);
+	} else {
+		(void)atomic_fetch_sub(&blocked_producers, 1u);
+	}
+#else
+	UINT lock_state = event_queue_lock();
+	blocked_producers = blocked ? (blocked_producers + 1u) : (blocked_producers - 1u);
+	event_queue_unlock(lock_state);
+#endif // EVENT_LOCK_FREE_QUEUE == 1
+}
+
+/**
+ * Blocks the producer until space is available in a queue or the timeout expires.
+ *
+ * @param start_time the time the offer started at, from tx_time_get().
+ * @param timeout the timeout of the offer in ThreadX ticks, or TX_WAIT_FOREVER.
+ * @return true if space may be available, false if the timeout has expired.
+ */
+static bool wait_for_space(ULONG start_time, ULONG timeout) {
+	ULONG remaining = timeout;
+	if (TX_WAIT_FOREVER != timeout) {
+		ULONG elapsed = tx_time_get() - start_time;
+		remaining = (elapsed < timeout) ? (timeout - elapsed) : TX_NO_WAIT;
+	}
+	return (TX_NO_WAIT != remaining) && (TX_SUCCESS == tx_semaphore_get(&space_semaphore, remaining));
+}
+
+#endif // EVENT_BLOCKING_OFFER_SUPPORT == 1
+
+/**
+ * Gets the index of the payload buffer of a queue following a number of words from an index.
+ */
+static uint32_t get_payload_index(const event_queue_t* queue, uint32_t index, uint32_t words) {
+	uint32_t next_index = index + words;
+	if (next_index >= queue->payload_buffer_words) {
+		next_index -= queue->payload_buffer_words;
+	}
+	return next_index;
+}
+
+/**
+ * Gets the number of 32-bit words that can be written in the payload buffer of a queue.
+ *
+ * @param write_index the index of the next word to write.
+ */
+static uint32_t get_payload_free_words(const event_queue_t* queue, uint32_t write_index) {
+	uint32_t read_index = queue->payload_read_index;
+	uint32_t free_words;
+	if (read_index > write_index) {
+		free_words = read_index - write_index - 1u;
+	} else {
+		free_words = (queue->payload_buffer_words - write_index) + read_index - 1u;
+	}
+	return free_words;
+}
+
+/**
+ * Copies the data of an extended event in the payload buffer of a queue, in at most two parts when the end of the
+ * buffer is reached. The write index of the queue is not updated.
+ * Must be called within the critical section protecting the event queues (or on reserved words with the lock-free
+ * backend), once checked that there is enough space.
+ *
+ * @param write_index the index of the first word to write.
+ * @return the index following the last word written.
+ */
+static uint32_t write_payload(event_queue_t* queue, uint32_t write_index, const uint8_t* data, uint32_t data_length) {
+	uint32_t words = LLEVENT_FRAMING_get_payload_words(data_length);
+	uint32_t first_part_words = queue->payload_buffer_words - write_index;
+
+	if (words <= first_part_words) {
+		(void)memcpy(&queue->payload_buffer[write_index], data, data_length);
+		write_index += words;
+		if (write_index == queue->payload_buffer_words) {
+			write_index = 0;
+		}
+	} else {
+		uint32_t first_part_length = first_part_words * (uint32_t)sizeof(uint32_t);
+		(void)memcpy(&queue->payload_buffer[write_index], data, first_part_length);
+		(void)memcpy(&queue->payload_buffer[0], &data[first_part_length], data_length - first_part_length);
+		write_index = words - first_part_words;
+	}
+	return write_index;
+}
+
+/**
+ * Gets the number of 32-bit words of the payload buffer taken by the data of an extended event.
+ *
+ * @param mapped_data the mapped data of the extended event, NULL if its data is copied.
+ */
+static uint32_t get_extended_event_words(uint32_t data_length, const mapped_data_t* mapped_data) {
+#if (EVENT_MAPPED_DATA_SUPPORT == 1) || (EVENT_DELTA_TYPE_COUNT > 0)
+	// The kind of data, then the data itself or its mapping.
+	return 1u + ((NULL != mapped_data) ? LLEVENT_FRAMING_get_payload_words((uint32_t)sizeof(mapped_data_t)) :
+	                                     LLEVENT_FRAMING_get_payload_words(data_length));
+#else
+	(void)mapped_data;
+	return LLEVENT_FRAMING_get_payload_words(data_length);
+#endif // (EVENT_MAPPED_DATA_SUPPORT == 1) || (EVENT_DELTA_TYPE_COUNT > 0)
+}
+
+/**
+ * Writes the data of an extended event in the payload buffer of a queue: the data itself or, for a mapped extended
+ * event, its mapping. Same constraints as write_payload().
+ *
+ * @param write_index the index of the first word to write.
+ * @param mapped_data the mapped data of the extended event, NULL if its data is copied.
+ * @return the index following the last word written.
+ */
+static uint32_t write_extended_payload(event_queue_t* queue, uint32_t write_index, const uint8_t* data,
+                                       uint32_t data_length, const mapped_data_t* mapped_data) {
+	uint32_t end_index;
+#if (EVENT_MAPPED_DATA_SUPPORT == 1) || (EVENT_DELTA_TYPE_COUNT > 0)
+	uint32_t kind = (NULL != mapped_data) ? EXTENDED_DATA_MAPPED : EXTENDED_DATA_COPIED;
+	end_index = write_payload(queue, write_index, (const uint8_t*)&kind, (uint32_t)sizeof(kind));
+	if (NULL != mapped_data) {
+		end_index = write_payload(queue, end_index, (const uint8_t*)mapped_data, (uint32_t)sizeof(mapped_data_t));
+	} else {
+		end_index = write_payload(queue, end_index, data, data_length);
+	}
+#else
+	(void)mapped_data;
+	end_index = write_payload(queue, write_index, data, data_length);
+#endif // (EVENT_MAPPED_DATA_SUPPORT == 1) || (EVENT_DELTA_TYPE_COUNT > 0)
+	return end_index;
+}
+
+#if EVENT_DELTA_TYPE_COUNT > 0
+
+/**
+ * Encodes the data of an extended event as the runs of bytes that differ from the data of the previous extended event
+ * of its type, of the same length. Each run is made of the number of unchanged bytes that precede it, the number of
+ * changed bytes, then the changed bytes. A single unchanged byte between two changed bytes is kept in the run, it takes
+ * less bytes than a new run. The unchanged bytes that end the data are not encoded.
+ *
+ * @param reference the data of the previous extended event.
+ * @param data the data of the extended event.
+ * @param data_length the number of bytes of both data, at most EVENT_DELTA_MAX_DATA_LENGTH.
+ * @param runs the destination of the runs, of at least data_length bytes.
+ * @return the number of bytes of the runs, data_length if the runs are not shorter than the data.
+ */
+static uint32_t encode_delta(const uint8_t* reference, const uint8_t* data, uint32_t data_length, uint8_t* runs) {
+	uint32_t runs_length = 0;
+	uint32_t index = 0;
+	bool shorter = true;
+	while (shorter && (index < data_length)) {
+		uint32_t unchanged = 0;
+		while ((index < data_length) && (unchanged < DELTA_MAX_RUN_LENGTH) && (data[index] == reference[index])) {
+			unchanged++;
+			index++;
+		}
+		uint32_t run_index = index;
+		uint32_t changed = 0;
+		while ((index < data_length) && (changed < DELTA_MAX_RUN_LENGTH) &&
+		       ((data[index] != reference[index]) || ((0u != changed) && ((index + 1u) < data_length) &&
+		                                              (data[index + 1u] != reference[index + 1u])))) {
+			changed++;
+			index++;
+		}
+		// No run for the unchanged bytes that end the data.
+		if ((index < data_length) || (0u != changed)) {
+			if ((runs_length + 2u + changed) < data_length) {
+				runs[runs_length] = (uint8_t)unchanged;
+				runs[runs_length + 1u] = (uint8_t)changed;
+				(void)memcpy(&runs[runs_length + 2u], &data[run_index], changed);
+				runs_length += 2u + changed;
+			} else {
+				shorter = false;
+			}
+		}
+	}
+	return shorter ? runs_length : data_length;
+}
+
+/**
+ * Decodes the runs of a delta-encoded extended event (see encode_delta()) into the data of the previous extended event
+ * of its type.
+ *
+ * @param reference the data of the previous extended event, replaced by the data of the extended event.
+ * @param reference_length the number of bytes of the reference.
+ * @param runs the runs of the extended event.
+ * @param runs_length the number of bytes of the runs.
+ * @return true if the runs have been decoded, false if they exceed the reference.
+ */
+static bool decode_delta(uint8_t* reference, uint32_t reference_length, const uint8_t* runs, uint32_t runs_length) {
+	bool valid = true;
+	uint32_t index = 0;
+	uint32_t offset = 0;
+	while (valid && (offset < runs_length)) {
+		valid = (offset + 2u) <= runs_length;
+		if (valid) {
+			index += (uint32_t)runs[offset];
+			uint32_t changed = (uint32_t)runs[offset + 1u];
+			offset += 2u;
+			valid = ((offset + changed) <= runs_length) && ((index + changed) <= reference_length);
+			if (valid) {
+				(void)memcpy(&reference[index], &runs[offset], changed);
+				index += changed;
+				offset += changed;
+			}
+		}
+	}
+	return valid;
+}
+
+/**
+ * Gets the number of bytes stored after the first word of the payload of a delta-encoded extended event.
+ *
+ * @param kind the first word of the payload, of the EXTENDED_DATA_REFERENCE or EXTENDED_DATA_DELTA kind.
+ */
+static inline uint32_t get_delta_stored_length(uint32_t kind) {
+	return kind >> DELTA_LENGTH_SHIFT;
+}
+
+/**
+ * Encodes the data of an extended event of a delta-encoded type against the previous extended event of its type sent
+ * to its queue. Called within the critical section.
+ *
+ * @param type the type of the event.
+ * @param mapped_data the mapped data of the event, NULL if its data is copied.
+ * @param data the data of the event, replaced by delta_encoding_buffer for the EXTENDED_DATA_DELTA kind.
+ * @param data_length the number of bytes of data, replaced by the number of bytes of the runs for the
+ * EXTENDED_DATA_DELTA kind.
+ * @return the first word of the payload of the event: EXTENDED_DATA_COPIED if the event is not delta-encoded,
+ * otherwise EXTENDED_DATA_REFERENCE or EXTENDED_DATA_DELTA with the index of the references and the number of bytes
+ * stored.
+ */
+static uint32_t encode_delta_event(uint32_t type, const mapped_data_t* mapped_data, const uint8_t** data,
+                                   uint32_t* data_length) {
+	uint32_t kind = EXTENDED_DATA_COPIED;
+	uint32_t reference_index = (uint32_t)event_types[type].delta_reference;
+	if ((0u != reference_index) && (NULL == mapped_data) && (*data_length <= (uint32_t)EVENT_DELTA_MAX_DATA_LENGTH)) {
+		reference_index--;
+		const delta_reference_t* reference = &delta_references[reference_index];
+		if (reference->encoding) {
+			uint32_t runs_length = *data_length;
+			if (reference->offered_length == *data_length) {
+				runs_length = encode_delta((const uint8_t*)reference->offered_data, *data, *data_length,
+				                           (uint8_t*)delta_encoding_buffer);
+			}
+			if (runs_length < *data_length) {
+				kind = EXTENDED_DATA_DELTA;
+				*data = (const uint8_t*)delta_encoding_buffer;
+				*data_length = runs_length;
+			} else {
+				kind = EXTENDED_DATA_REFERENCE;
+			}
+			kind |= (reference_index << DELTA_REFERENCE_SHIFT) | (*data_length << DELTA_LENGTH_SHIFT);
+		}
+	}
+	return kind;
+}
+
+/**
+ * Gets the number of 32-bit words of the payload buffer taken by a delta-encoded extended event.
+ *
+ * @param kind the first word of its payload (see encode_delta_event()).
+ */
+static inline uint32_t get_delta_event_words(uint32_t kind) {
+	return 1u + LLEVENT_FRAMING_get_payload_words(get_delta_stored_length(kind));
+}
+
+/**
+ * Writes a delta-encoded extended event in the payload buffer of a queue: the first word of its payload, then its data
+ * or its runs. Same constraints as write_payload().
+ *
+ * @param write_index the index of the first word to write.
+ * @param kind the first word of the payload (see encode_delta_event()).
+ * @param data the data or the runs of the event.
+ * @return the index following the last word written.
+ */
+static uint32_t write_delta_payload(event_queue_t* queue, uint32_t write_index, uint32_t kind, const uint8_t* data) {
+	uint32_t end_index = write_payload(queue, write_index, (const uint8_t*)&kind, (uint32_t)sizeof(kind));
+	return write_payload(queue, end_index, data, get_delta_stored_length(kind));
+}
+
+/**
+ * Keeps the data of a delta-encoded extended event sent to its queue: the next extended event of its type is encoded
+ * against it. Called within the critical section.
+ *
+ * @param kind the first word of the payload of the event (see encode_delta_event()).
+ * @param data the data of the event, not encoded.
+ * @param data_length the number of bytes of data.
+ */
+static void set_delta_reference(uint32_t kind, const uint8_t* data, uint32_t data_length) {
+	delta_reference_t* reference = &delta_references[(kind >> DELTA_REFERENCE_SHIFT) & DELTA_KIND_MASK];
+	(void)memcpy(reference->offered_data, data, data_length);
+	reference->offered_length = data_length;
+}
+
+#endif // EVENT_DELTA_TYPE_COUNT > 0
+
+/**
+ * Gets the next 32-bit word of the extended event being read from the payload buffer of reading_queue.
+ *
+ * @param reader the reader of the extended event.
+ * @param word the destination of the word.
+ * @return TX_SUCCESS if a word has been read, TX_QUEUE_EMPTY if all the words of the extended event have been read.
+ */
+static inline UINT payload_receive(event_reader_t* reader, void* word) {
+	UINT status = TX_QUEUE_EMPTY;
+	uint32_t read_index = reader->payload_event_read_index;
+	if (read_index != reader->payload_event_end_index) {
+#if (EVENT_MAPPED_DATA_SUPPORT == 1) || (EVENT_DELTA_TYPE_COUNT > 0)
+		if (NULL != reader->reading_mapped_data.data) {
+			// Never read past the mapped data: the bytes of the last word following the data are left to 0.
+			uint32_t offset = read_index * (uint32_t)sizeof(uint32_t);
+			uint32_t length = reader->data_length_extended_data - offset;
+			(void)memset(word, 0, sizeof(uint32_t));
+			(void)memcpy(word, &reader->reading_mapped_data.data[offset], (length < (uint32_t)sizeof(uint32_t)) ? length :
+			             sizeof(uint32_t));
+			reader->payload_event_read_index = read_index + 1u;
+		} else
+#endif // (EVENT_MAPPED_DATA_SUPPORT == 1) || (EVENT_DELTA_TYPE_COUNT > 0)
+		{
+			(void)memcpy(word, &reader->reading_queue->payload_buffer[read_index], sizeof(uint32_t));
+			read_index++;
+			reader->payload_event_read_index = (read_index == reader->reading_queue->payload_buffer_words) ? 0u : read_index;
+		}
+		status = TX_SUCCESS;
+	}
+	return status;
+}
+
+/**
+ * Gets the number of 32-bit words of the extended event being read that remain in the payload buffer of reading_queue.
+ */
+static inline uint32_t get_payload_event_remaining_words(const event_reader_t* reader) {
+	uint32_t read_index = reader->payload_event_read_index;
+	uint32_t end_index = reader->payload_event_end_index;
+	return (end_index >= read_index) ? (end_index - read_index) :
+	       ((reader->reading_queue->payload_buffer_words - read_index) + end_index);
+}
+
+/**
+ * Skips the next 32-bit words of the extended event being read from the payload buffer of reading_queue in constant time.
+ *
+ * @param reader the reader of the extended event.
+ * @param words the number of words to skip.
+ * @return the number of words skipped, less than words if the end of the extended event is reached.
+ */
+static uint32_t payload_skip_words(event_reader_t* reader, uint32_t words) {
+	uint32_t event_words = get_payload_event_remaining_words(reader);
+	uint32_t skipped_words = (words < event_words) ? words : event_words;
+	uint32_t read_index = reader->payload_event_read_index + skipped_words;
+#if (EVENT_MAPPED_DATA_SUPPORT == 1) || (EVENT_DELTA_TYPE_COUNT > 0)
+	if (NULL != reader->reading_mapped_data.data) {
+		// No wrap in the mapped data.
+	} else
+#endif // (EVENT_MAPPED_DATA_SUPPORT == 1) || (EVENT_DELTA_TYPE_COUNT > 0)
+	if (read_index >= reader->reading_queue->payload_buffer_words) {
+		read_index -= reader->reading_queue->payload_buffer_words;
+	}
+	reader->payload_event_read_index = read_index;
+
+	return skipped_words;
+}
+
+/**
+ * Updates the reading state of the extended data after whole 32-bit words have been read or skipped at once.
+ *
+ * @param reader the reader of the extended event.
+ * @param words the number of words read or skipped.
+ */
+static inline void extended_data_words_read(event_reader_t* reader, uint32_t words) {
+	reader->offset_extended_data_read += words * (uint32_t)sizeof(uint32_t);
+	// Switch the alignment for an odd number of words.
+	if ((words & 1u) == 1u) {
+		reader->data_alignment = reader->data_alignment == (uint8_t)0 ? 1 : 0;
+	}
+}
+
+/**
+ * Copies the next 32-bit words of the extended event being read from the payload buffer of reading_queue, in at most two parts when the
+ * end of the buffer is reached.
+ *
+ * @param reader the reader of the extended event.
+ * @param destination the destination of the words, no alignment required.
+ * @param words the number of words to read.
+ * @return the number of words read, less than words if the end of the extended event is reached.
+ */
+static uint32_t payload_read_words(event_reader_t* reader, uint8_t* destination, uint32_t words) {
+	uint32_t read_index = reader->payload_event_read_index;
+	uint32_t event_words = get_payload_event_remaining_words(reader);
+	uint32_t read_words = (words < event_words) ? words : event_words;
+	uint32_t first_part_words = reader->reading_queue->payload_buffer_words - read_index;
+
+#if (EVENT_MAPPED_DATA_SUPPORT == 1) || (EVENT_DELTA_TYPE_COUNT > 0)
+	if (NULL != reader->reading_mapped_data.data) {
+		// Copy straight from the mapped data, without the padding of its last word.
+		uint32_t offset = read_index * (uint32_t)sizeof(uint32_t);
+		uint32_t length = read_words * (uint32_t)sizeof(uint32_t);
+		if (length > (reader->data_length_extended_data - offset)) {
+			length = reader->data_length_extended_data - offset;
+		}
+		(void)memcpy(destination, &reader->reading_mapped_data.data[offset], length);
+		read_index += read_words;
+	} else
+#endif // (EVENT_MAPPED_DATA_SUPPORT == 1) || (EVENT_DELTA_TYPE_COUNT > 0)
+	if (read_words < first_part_words) {
+		(void)memcpy(destination, &reader->reading_queue->payload_buffer[read_index], read_words * (uint32_t)sizeof(uint32_t));
+		read_index += read_words;
+	} else {
+		(void)memcpy(destination, &reader->reading_queue->payload_buffer[read_index], first_part_words * (uint32_t)sizeof(uint32_t));
+		read_index = read_words - first_part_words;
+		(void)memcpy(&destination[first_part_words * (uint32_t)sizeof(uint32_t)], &reader->reading_queue->payload_buffer[0],
+		             read_index * (uint32_t)sizeof(uint32_t));
+	}
+	reader->payload_event_read_index = read_index;
+
+	return read_words;
+}
+
+#if EVENT_READ_STAGING_BUFFER_SIZE > 0
+
+/**
+ * Copies the words of the extended event being read from the payload buffer of reading_queue into staging_buffer, if
+ * they fit.
+ *
+ * @param reader the reader of the extended event.
+ * @param data_length the number of bytes of data of the extended event.
+ * @return the number of words staged, 0 if the extended event is too large to be staged.
+ */
+static uint32_t stage_extended_data(event_reader_t* reader, uint32_t data_length) {
+	uint32_t words = LLEVENT_FRAMING_get_payload_words(data_length);
+	uint32_t read_words = 0;
+	if ((0u != words) && (words <= STAGING_BUFFER_WORDS)) {
+		read_words = payload_read_words(reader, (uint8_t*)reader->staging_buffer, words);
+	}
+	return read_words;
+}
+
+/**
+ * Takes the next value of a staged extended event: its offset is aligned on its size, like the values read from the
+ * payload buffer, and the bytes skipped for the alignment and the value are counted as read.
+ * Throws IOException if the value exceeds the data of the extended event.
+ *
+ * @param reader the reader of the extended event.
+ * @param size the size of the value, 1, 2, 4 or 8 bytes.
+ * @param offset the destination of the offset of the value in staging_buffer.
+ * @return true if the value can be read at offset, false otherwise.
+ */
+static bool take_staged_value(event_reader_t* reader, uint32_t size, uint32_t* offset) {
+	uint32_t value_offset = (reader->offset_extended_data_read + size - 1u) & ~(size - 1u);
+	bool taken = (value_offset + size) <= reader->data_length_extended_data;
+	if (taken) {
+		*offset = value_offset;
+		reader->offset_extended_data_read = value_offset + size;
+	} else if (SNI_throwNativeIOException(EVENT_NOK, "Not enough bytes remaining in the extended data.") == SNI_ERROR) {
+		LLEVENT_ERROR_TRACE("during EventDataReader reading: Not enough bytes remaining in the extended data.\n");
+		LLEVENT_ERROR_TRACE(
+			"This function is not called within the virtual machine task or if the current thread is suspended.\n");
+	} else {
+		// IOException thrown.
+	}
+	return taken;
+}
+
+/**
+ * Gets the word of staging_buffer holding the byte at an offset, shifted to put this byte in the lowest bits.
+ */
+static inline uint32_t get_staged_word(const event_reader_t* reader, uint32_t offset) {
+	return reader->staging_buffer[offset / (uint32_t)sizeof(uint32_t)] >> ((offset % (uint32_t)sizeof(uint32_t)) * 8u);
+}
+
+#endif // EVENT_READ_STAGING_BUFFER_SIZE > 0
+
+#if EVENT_COALESCING_SUPPORT == 1
+
+/**
+ * Gets the event to return in place of an event fetched from a queue: the last event offered for its type if it has
+ * been coalesced.
+ *
+ * @param event_message the event fetched from the queue.
+ * @return the event to return to the Java thread.
+ */
+static uint32_t take_coalesced_event(uint32_t event_message) {
+	uint32_t type = LLEVENT_FRAMING_get_type(event_message);
+	uint32_t coalesced_event = COALESCED_EVENT_NONE;
+	// Only a simple event can be coalesced.
+	if (!LLEVENT_FRAMING_is_extended(event_message)) {
+#if EVENT_LOCK_FREE_QUEUE == 1
+		if (COALESCED_EVENT_NONE != atomic_load(&coalesced_events[type])) {
+			coalesced_event = atomic_exchange(&coalesced_events[type], COALESCED_EVENT_NONE);
+		}
+#else
+		if (COALESCED_EVENT_NONE != coalesced_events[type]) {
+			UINT lock_state = event_queue_lock();
+			coalesced_event = coalesced_events[type];
+			coalesced_events[type] = COALESCED_EVENT_NONE;
+			event_queue_unlock(lock_state);
+		}
+#endif // EVENT_LOCK_FREE_QUEUE == 1
+	}
+	return (COALESCED_EVENT_NONE != coalesced_event) ? coalesced_event : event_message;
+}
+
+#endif // EVENT_COALESCING_SUPPORT == 1
+
+#if EVENT_LOCK_FREE_QUEUE == 1
+
+/**
+ * Reserves words in the ring buffer of a queue. Can be called concurrently by several producers, including
+ * interrupt handlers.
+ *
+ * @param queue the queue.
+ * @param words the number of words to reserve.
+ * @param write_index the destination of the index of the first reserved word.
+ * @return true if the words have been reserved, false if the queue is full.
+ */
+static bool reserve_words(event_queue_t* queue, uint32_t words, uint32_t* write_index) {
+	bool reserved = false;
+	uint32_t first_index = atomic_load(&queue->payload_write_index);
+	bool full = false;
+	while (!reserved && !full) {
+		if (get_payload_free_words(queue, first_index) < words) {
+			full = true;
+		} else {
+			uint32_t next_index = first_index + words;
+			if (next_index >= queue->payload_buffer_words) {
+				next_index -= queue->payload_buffer_words;
+			}
+			// On failure, first_index is updated with the index reserved by another producer.
+			reserved = atomic_compare_exchange_weak(&queue->payload_write_index, &first_index, next_index);
+#if EVENT_INSTRUMENTATION == 1
+			if (!reserved) {
+				LLEVENT_STATISTICS_record_contention(0);
+			} else {
+				LLEVENT_STATISTICS_record_queue_usage((uint32_t)(queue - &event_queues[0]),
+				                                      (queue->payload_buffer_words - 1u) -
+				                                      get_payload_free_words(queue, next_index), 0);
+			}
+#endif // EVENT_INSTRUMENTATION == 1
+		}
+	}
+	*write_index = first_index;
+	return reserved;
+}
+
+/**
+ * Commits an event in the ring buffer of a queue by writing its first word, once all its other words are written.
+ */
+static void commit_event(event_queue_t* queue, uint32_t write_index, uint32_t event_message) {
+#if OFFER_TIMESTAMPS == 1
+	queue->timestamps[write_index] = EVENT_TIMESTAMP();
+#endif // OFFER_TIMESTAMPS == 1
+	atomic_thread_fence(memory_order_release);
+	((volatile uint32_t*)queue->payload_buffer)[write_index] = event_message;
+}
+
+/**
+ * Offers an event to the queue, without lock.
+ *
+ * @param type the type of the event.
+ * @param data the data of the event.
+ * @param flags the OFFER_* flags of the offer.
+ * @return true if the message has been sent, false otherwise.
+ */
+static bool offer_event(uint32_t type, uint32_t data, uint32_t flags) {
+	bool from_isr = (flags & OFFER_FROM_ISR) != 0u;
+	// Create the message from the type and the data.
+	uint32_t event_message = LLEVENT_FRAMING_simple_event(type, data);
+	event_queue_t* queue = &event_queues[event_types[type].priority];
+	bool send_event = true;
+	bool offer_status = true;
+
+#if EVENT_COALESCING_SUPPORT == 1
+	bool coalescing = event_types[type].coalescing;
+	if (coalescing) {
+		// If an event of this type is still in the queue, replace it by this one instead of sending a new event. The
+		// event of the type is never set here when there is none: the queue may be full.
+		uint32_t queued_event = atomic_load(&coalesced_events[type]);
+		while ((COALESCED_EVENT_NONE != queued_event) &&
+		       !atomic_compare_exchange_weak(&coalesced_events[type], &queued_event, event_message)) {
+			// On failure, queued_event is updated with the event set by another producer or by the Java thread.
+		}
+		send_event = COALESCED_EVENT_NONE == queued_event;
+	}
+#endif // EVENT_COALESCING_SUPPORT == 1
+
+	if (send_event) {
+		uint32_t write_index;
+		offer_status = reserve_words(queue, 1, &write_index);
+		if (offer_status) {
+			uint32_t committed_message = event_message;
+#if EVENT_COALESCING_SUPPORT == 1
+			// Another producer may have queued an event of this type since: coalesce with it, and skip the reserved
+			// word.
+			if (coalescing && (COALESCED_EVENT_NONE != atomic_exchange(&coalesced_events[type], event_message))) {
+				committed_message = EVENT_SKIPPED_SLOT;
+			}
+#endif // EVENT_COALESCING_SUPPORT == 1
+			commit_event(queue, write_index, committed_message);
+			// If a Java thread is waiting to read an event, notify it (also for a skipped word: the Java thread may
+			// wait for it to read the events committed after it).
+			event_consumer_t* consumer = &event_consumers[queue->consumer];
+			int32_t java_thread_id = take_java_thread_to_wake(consumer, 1u, is_type_urgent(type));
+			resume_waiting_java_thread(consumer, java_thread_id, from_isr);
+		} else {
+			// Queue full, reported by the returned status only.
+		}
+	}
+	LLEVENT_TRACE_RECORD(offer_status ? LLEVENT_TRACE_EVENT_OFFER : LLEVENT_TRACE_EVENT_QUEUE_FULL, event_message,
+	                     event_types[type].priority);
+	if (offer_status) {
+		LLEVENT_REPLAY_RECORD(event_message, NULL);
+	}
+#if EVENT_INSTRUMENTATION == 1
+	if (offer_status || ((flags & OFFER_RETRIED) == 0u)) {
+		LLEVENT_STATISTICS_record_offer(type, offer_status);
+	}
+#endif // EVENT_INSTRUMENTATION == 1
+#if EVENT_OVERFLOW_POLICY_SUPPORT == 1
+	if (!offer_status && ((flags & OFFER_RETRIED) == 0u)) {
+		count_dropped_event(type);
+	}
+#endif // EVENT_OVERFLOW_POLICY_SUPPORT == 1
+
+	return offer_status;
+}
+
+/**
+ * Offers an extended event to the queue, without lock.
+ *
+ * @param type the type of the event.
+ * @param data the data of the event.
+ * @param data_length the number of bytes of data.
+ * @param mapped_data the mapped data of the event, NULL to copy the data.
+ * @param flags the OFFER_* flags of the offer.
+ * @return true if the message has been sent, false otherwise.
+ */
+static bool offer_extended_event(uint32_t type, const void* data, uint32_t data_length,
+                                 const mapped_data_t* mapped_data, uint32_t flags) {
+	bool from_isr = (flags & OFFER_FROM_ISR) != 0u;
+	// Create the first uint32_t of the extended event that contain the type and the data length (number of bytes).
+	uint32_t event_message = LLEVENT_FRAMING_extended_event(type, data_length);
+	event_queue_t* queue = &event_queues[event_types[type].priority];
+
+	// Convert the data.
+	// cppcheck-suppress [misra-c2012-11.5]: conversion from void* to uint8_t* necessary to copy the input data.
+	const uint8_t* event_data = (const uint8_t*)data;
+
+	// Reserve the first word and the data words at once.
+	uint32_t write_index;
+	bool offer_status = reserve_words(queue, get_extended_event_words(data_length, mapped_data) + 1u, &write_index);
+	if (offer_status) {
+		uint32_t data_index = write_index + 1u;
+		if (data_index == queue->payload_buffer_words) {
+			data_index = 0;
+		}
+		// Unused return value: the end of the reservation is already known.
+		uint32_t end_index = write_extended_payload(queue, data_index, event_data, data_length, mapped_data);
+		(void)end_index;
+		// Recorded before the event is visible to the Java thread, which may release the data of a mapped event at
+		// once.
+		LLEVENT_REPLAY_RECORD(event_message, data);
+		commit_event(queue, write_index, event_message);
+		// If a Java thread is waiting to read an event, notify it.
+		event_consumer_t* consumer = &event_consumers[queue->consumer];
+		int32_t java_thread_id = take_java_thread_to_wake(consumer, 1u, is_type_urgent(type));
+		resume_waiting_java_thread(consumer, java_thread_id, from_isr);
+	} else {
+		// Queue full, reported by the returned status only.
+	}
+	LLEVENT_TRACE_RECORD(offer_status ? LLEVENT_TRACE_EVENT_OFFER : LLEVENT_TRACE_EVENT_QUEUE_FULL, event_message,
+	                     event_types[type].priority);
+#if EVENT_INSTRUMENTATION == 1
+	if (offer_status || ((flags & OFFER_RETRIED) == 0u)) {
+		LLEVENT_STATISTICS_record_offer(type, offer_status);
+	}
+#endif // EVENT_INSTRUMENTATION == 1
+#if EVENT_OVERFLOW_POLICY_SUPPORT == 1
+	if (!offer_status && ((flags & OFFER_RETRIED) == 0u)) {
+		count_dropped_event(type);
+	}
+#endif // EVENT_OVERFLOW_POLICY_SUPPORT == 1
+
+	return offer_status;
+}
+
+/**
+ * Offers a batch of events to the queue of their priority, without lock. The words of all the events are reserved at
+ * once and the first event is committed last: the Java thread, which stops at its empty word, sees the whole batch at
+ * once.
+ *
+ * @param events the events of the batch, all of the same priority.
+ * @param count the number of events, between 1 and LLEVENT_BATCH_MAX_EVENTS.
+ * @param flags the OFFER_* flags of the offer.
+ * @return true if all the events have been sent, false if none has been sent.
+ */
+static bool offer_events(const LLEVENT_batch_event_t* events, uint32_t count, uint32_t flags) {
+	bool from_isr = (flags & OFFER_FROM_ISR) != 0u;
+	event_queue_t* queue = &event_queues[event_types[events[0].type].priority];
+	uint32_t kept_events = filter_batch_events(events, count);
+
+	// The words of the events of the batch that have not been discarded.
+	uint32_t words = 0;
+	uint32_t kept_count = 0;
+	for (uint32_t i = 0; i < count; i++) {
+		if ((kept_events & ((uint32_t)1u << i)) != 0u) {
+			words += 1u;
+			if (NULL != events[i].extended_data) {
+				words += get_extended_event_words((uint32_t)events[i].data, NULL);
+			}
+			kept_count++;
+		}
+	}
+
+	uint32_t write_index = 0;
+	bool offer_status = (0u == kept_count) || reserve_words(queue, words, &write_index);
+	if (offer_status && (0u != kept_count)) {
+		uint32_t first_index = write_index;
+		uint32_t first_message = 0;
+		bool first_event = true;
+		for (uint32_t i = 0; i < count; i++) {
+			if ((kept_events & ((uint32_t)1u << i)) != 0u) {
+				uint32_t event_index = write_index;
+				uint32_t event_message = get_batch_event_message(&events[i]);
+				write_index++;
+				if (write_index == queue->payload_buffer_words) {
+					write_index = 0;
+				}
+				if (NULL != events[i].extended_data) {
+					// cppcheck-suppress [misra-c2012-11.5]: conversion from void* to uint8_t* necessary to copy the input
+					// data.
+					write_index = write_extended_payload(queue, write_index, (const uint8_t*)events[i].extended_data,
+					                                     (uint32_t)events[i].data, NULL);
+				}
+				if (first_event) {
+					first_index = event_index;
+					first_message = event_message;
+					first_event = false;
+				} else {
+					commit_event(queue, event_index, event_message);
+				}
+				LLEVENT_TRACE_RECORD(LLEVENT_TRACE_EVENT_OFFER, event_message, event_types[events[i].type].priority);
+				LLEVENT_REPLAY_RECORD(event_message, events[i].extended_data);
+			}
+		}
+		commit_event(queue, first_index, first_message);
+		// If a Java thread is waiting to read an event, notify it once for the batch.
+		event_consumer_t* consumer = &event_consumers[queue->consumer];
+		int32_t java_thread_id = take_java_thread_to_wake(consumer, kept_count,
+		                                                  is_batch_urgent(events, count, kept_events));
+		resume_waiting_java_thread(consumer, java_thread_id, from_isr);
+	} else if (!offer_status) {
+		// Queue full, reported by the returned status only.
+		LLEVENT_TRACE_RECORD(LLEVENT_TRACE_EVENT_QUEUE_FULL, get_batch_event_message(&events[0]),
+		                     event_types[events[0].type].priority);
+	} else {
+		// All the events of the batch have been discarded.
+	}
+#if EVENT_INSTRUMENTATION == 1
+	record_batch_offer(events, count, kept_events, offer_status);
+#endif // EVENT_INSTRUMENTATION == 1
+#if EVENT_OVERFLOW_POLICY_SUPPORT == 1
+	if (!offer_status) {
+		count_dropped_batch(events, count, kept_events);
+	}
+#endif // EVENT_OVERFLOW_POLICY_SUPPORT == 1
+
+	return offer_status;
+}
+
+/**
+ * Fetches an event from the queue of a priority, without waiting. The first word of an extended event is released,
+ * its data words are released by LLEVENT_IMPL_end_read_extended_data().
+ *
+ * @param consumer the consumer of the queue.
+ * @param priority the priority of the queue.
+ * @param event_message the destination of the event.
+ * @return TX_SUCCESS if an event has been fetched, TX_QUEUE_EMPTY if the queue is empty.
+ */
+static UINT receive_queue_event(event_consumer_t* consumer, uint32_t priority, uint32_t* event_message) {
+	UINT status = TX_QUEUE_EMPTY;
+	event_queue_t* queue = &event_queues[priority];
+	volatile uint32_t* buffer = queue->payload_buffer;
+	uint32_t read_index = queue->payload_read_index;
+	uint32_t message = buffer[read_index];
+#if EVENT_COALESCING_SUPPORT == 1
+	// Release the words of the events coalesced after their reservation.
+	while (EVENT_SKIPPED_SLOT == message) {
+		buffer[read_index] = EVENT_EMPTY_SLOT;
+		read_index = get_payload_index(queue, read_index, 1u);
+		atomic_thread_fence(memory_order_release);
+		queue->payload_read_index = read_index;
+#if EVENT_BLOCKING_OFFER_SUPPORT == 1
+		notify_space_available();
+#endif // EVENT_BLOCKING_OFFER_SUPPORT == 1
+		message = buffer[read_index];
+	}
+#endif // EVENT_COALESCING_SUPPORT == 1
+	if (EVENT_EMPTY_SLOT != message) {
+		atomic_thread_fence(memory_order_acquire);
+#if EVENT_INSTRUMENTATION == 1
+		LLEVENT_STATISTICS_record_latency(EVENT_TIMESTAMP() - queue->timestamps[read_index]);
+#endif // EVENT_INSTRUMENTATION == 1
+#if EVENT_TIMESTAMP_SUPPORT == 1
+		consumer->reader.event_timestamp = queue->timestamps[read_index];
+#endif // EVENT_TIMESTAMP_SUPPORT == 1
+		buffer[read_index] = EVENT_EMPTY_SLOT;
+		read_index++;
+		atomic_thread_fence(memory_order_release);
+		queue->payload_read_index = (read_index == queue->payload_buffer_words) ? 0u : read_index;
+#if EVENT_BLOCKING_OFFER_SUPPORT == 1
+		notify_space_available();
+#endif // EVENT_BLOCKING_OFFER_SUPPORT == 1
+#if EVENT_COALESCING_SUPPORT == 1
+		message = take_coalesced_event(message);
+#endif // EVENT_COALESCING_SUPPORT == 1
+		*event_message = message;
+		LLEVENT_TRACE_RECORD(LLEVENT_TRACE_EVENT_DEQUEUE, *event_message, priority);
+		// Remember the queue in case of an extended event, its data is in the payload buffer of this queue.
+		consumer->reader.reading_queue = queue;
+		status = TX_SUCCESS;
+	}
+	return status;
+}
+
+/**
+ * Releases the words of the extended event being read: they are emptied before being given back to the producers.
+ */
+static void release_payload_event(event_reader_t* reader) {
+	uint32_t read_index = reader->reading_queue->payload_read_index;
+	uint32_t end_index = reader->payload_event_release_index;
+	if (end_index >= read_index) {
+		(void)memset(&reader->reading_queue->payload_buffer[read_index], (int)0xFF,
+		             (end_index - read_index) * (uint32_t)sizeof(uint32_t));
+	} else {
+		(void)memset(&reader->reading_queue->payload_buffer[read_index], (int)0xFF,
+		             (reader->reading_queue->payload_buffer_words - read_index) * (uint32_t)sizeof(uint32_t));
+		(void)memset(&reader->reading_queue->payload_buffer[0], (int)0xFF, end_index * (uint32_t)sizeof(uint32_t));
+	}
+	atomic_thread_fence(memory_order_release);
+	reader->reading_queue->payload_read_index = end_index;
+#if EVENT_BLOCKING_OFFER_SUPPORT == 1
+	notify_space_available();
+#endif // EVENT_BLOCKING_OFFER_SUPPORT == 1
+}
+
+#else
+
+#if OFFER_TIMESTAMPS == 1
+
+/**
+ * Records the usage of a queue and keeps the offer time of the event just sent to it.
+ * Must be called within the critical section protecting the event queues, once the event is sent.
+ */
+static void record_sent_event(event_queue_t* queue) {
+#if EVENT_INSTRUMENTATION == 1
+	ULONG enqueued = 0;
+	// Unused return value: the queue is valid.
+	UINT status = tx_queue_info_get(&queue->queue, TX_NULL, &enqueued, TX_NULL, TX_NULL, TX_NULL, TX_NULL);
+	(void)status;
+	LLEVENT_STATISTICS_record_queue_usage((uint32_t)(queue - &event_queues[0]), (uint32_t)enqueued,
+	                                      (queue->payload_buffer_words - 1u) -
+	                                      get_payload_free_words(queue, queue->payload_write_index));
+#endif // EVENT_INSTRUMENTATION == 1
+	uint32_t timestamp_index = queue->timestamp_write_index + 1u;
+	queue->timestamp_write_index = (timestamp_index == queue->timestamp_count) ? 0u : timestamp_index;
+}
+
+#endif // OFFER_TIMESTAMPS == 1
+
+#if EVENT_REPLAY_LOG_SUPPORT == 1
+
+/**
+ * Records the events of a batch that have not been discarded into the replay log.
+ */
+static void record_batch_events(const LLEVENT_batch_event_t* events, uint32_t count, uint32_t kept_events) {
+	for (uint32_t i = 0; i < count; i++) {
+		if ((kept_events & ((uint32_t)1u << i)) != 0u) {
+			LLEVENT_REPLAY_record(get_batch_event_message(&events[i]), events[i].extended_data);
+		}
+	}
+}
+
+#endif // EVENT_REPLAY_LOG_SUPPORT == 1
+
+/**
+ * Offers an event to the queue.
+ *
+ * @param type the type of the event.
+ * @param data the data of the event.
+ * @param flags the OFFER_* flags of the offer.
+ * @return true if the message has been sent, false otherwise.
+ */
+static bool offer_event(uint32_t type, uint32_t data, uint32_t flags) {
+	bool from_isr = (flags & OFFER_FROM_ISR) != 0u;
+	// The boolean to return at the end of the method.
+	jboolean offer_status = JTRUE;
+	// Create the message from the type and the data.
+	uint32_t event_message = LLEVENT_FRAMING_simple_event(type, data);
+	event_queue_t* queue = &event_queues[event_types[type].priority];
+	int32_t java_thread_id = SNI_ERROR;
+	bool send_event = true;
+	// The status of the send, reported once out of the critical section.
+	UINT send_status = TX_SUCCESS;
+
+	// Enter the critical section before sending the event.
+	UINT lock_state = event_queue_lock();
+
+#if EVENT_COALESCING_SUPPORT == 1
+	if (event_types[type].coalescing) {
+		// If an event of this type is still in the queue, replace it by this one instead of sending a new event.
+		send_event = COALESCED_EVENT_NONE == coalesced_events[type];
+		coalesced_events[type] = event_message;
+	}
+#endif // EVENT_COALESCING_SUPPORT == 1
+
+	if (send_event) {
+#if OFFER_TIMESTAMPS == 1
+		queue->timestamps[queue->timestamp_write_index] = EVENT_TIMESTAMP();
+#endif // OFFER_TIMESTAMPS == 1
+		// Send the event into the queue, no wait since the queue should be available.
+		send_status = tx_queue_send(&queue->queue, &event_message, TX_NO_WAIT);
+		if (TX_SUCCESS != send_status) {
+			offer_status = JFALSE;
+#if EVENT_COALESCING_SUPPORT == 1
+			coalesced_events[type] = COALESCED_EVENT_NONE;
+#endif // EVENT_COALESCING_SUPPORT == 1
+		}
+
+		// If a Java thread is waiting to read an event, notify it once out of the critical section.
+		if (offer_status == (jboolean)JTRUE) {
+#if OFFER_TIMESTAMPS == 1
+			record_sent_event(queue);
+#endif // OFFER_TIMESTAMPS == 1
+			java_thread_id = take_java_thread_to_wake(&event_consumers[queue->consumer], 1u, is_type_urgent(type));
+		}
+	}
+	LLEVENT_TRACE_RECORD((offer_status == (jboolean)JTRUE) ? LLEVENT_TRACE_EVENT_OFFER : LLEVENT_TRACE_EVENT_QUEUE_FULL,
+	                     event_message, event_types[type].priority);
+#if EVENT_INSTRUMENTATION == 1
+	if ((offer_status == (jboolean)JTRUE) || ((flags & OFFER_RETRIED) == 0u)) {
+		LLEVENT_STATISTICS_record_offer(type, offer_status == (jboolean)JTRUE);
+	}
+#endif // EVENT_INSTRUMENTATION == 1
+#if EVENT_OVERFLOW_POLICY_SUPPORT == 1
+	if ((offer_status == (jboolean)JFALSE) && ((flags & OFFER_RETRIED) == 0u)) {
+		count_dropped_event(type);
+	}
+#endif // EVENT_OVERFLOW_POLICY_SUPPORT == 1
+
+	// Leave the critical section after sending the event.
+	event_queue_unlock(lock_state);
+
+	// Record the event out of the critical section, so that the copy of the record does not delay the other producers.
+	if (offer_status == (jboolean)JTRUE) {
+		LLEVENT_REPLAY_RECORD(event_message, NULL);
+	}
+
+	// Trace the failure out of the critical section, where the interrupts may be disabled. A full queue is reported
+	// by the returned status only.
+	if ((TX_SUCCESS != send_status) && (TX_QUEUE_FULL != send_status) &&
+	    ((flags & (OFFER_FROM_ISR | OFFER_RETRIED)) == 0u)) {
+		LLEVENT_ERROR_TRACE("during tx_queue_send ; status = 0x%x \n", send_status);
+	}
+
+	resume_waiting_java_thread(&event_consumers[queue->consumer], java_thread_id, from_isr);
+
+	return offer_status;
+}
+
+/**
+ * Offers an extended event to the queue.
+ *
+ * @param type the type of the event.
+ * @param data the data of the event.
+ * @param data_length the number of bytes of data.
+ * @param mapped_data the mapped data of the event, NULL to copy the data.
+ * @param flags the OFFER_* flags of the offer.
+ * @return true if the message has been sent, false otherwise.
+ */
+static bool offer_extended_event(uint32_t type, const void* data, uint32_t data_length,
+                                 const mapped_data_t* mapped_data, uint32_t flags) {
+	bool from_isr = (flags & OFFER_FROM_ISR) != 0u;
+	// The boolean to return at the end of the method.
+	jboolean offer_status = JTRUE;
+	// Create the first uint32_t of the extended event that contain the type and the data length (number of bytes).
+	uint32_t event_message = LLEVENT_FRAMING_extended_event(type, data_length);
+
+	// Convert the data.
+	// cppcheck-suppress [misra-c2012-11.5]: conversion from void* to uint8_t* necessary to copy the input data.
+	const uint8_t* event_data = (const uint8_t*)data;
+	event_queue_t* queue = &event_queues[event_types[type].priority];
+	// The status of the send, reported once out of the critical section.
+	UINT send_status = TX_SUCCESS;
+
+	// Enter the critical section before sending the extended event.
+	UINT lock_state = event_queue_lock();
+
+#if EVENT_DELTA_TYPE_COUNT > 0
+	// Encode the data within the critical section: the extended events of a type are encoded in the order of its queue.
+	const uint8_t* stored_data = event_data;
+	uint32_t stored_length = data_length;
+	uint32_t kind = encode_delta_event(type, mapped_data, &stored_data, &stored_length);
+	uint32_t payload_words = (EXTENDED_DATA_COPIED == kind) ? get_extended_event_words(data_length, mapped_data) :
+	                         get_delta_event_words(kind);
+#else
+	uint32_t payload_words = get_extended_event_words(data_length, mapped_data);
+#endif // EVENT_DELTA_TYPE_COUNT > 0
+
+	// Check that there is enough space in the payload buffer to store the extended data.
+	if (get_payload_free_words(queue, queue->payload_write_index) < payload_words) {
+		offer_status = JFALSE;
+	}
+
+	// Copy the data of the extended event, then send the first part of the event in the queue. The data is visible
+	// to the Java thread only once the first part is in the queue.
+	if (offer_status == (jboolean)JTRUE) {
+#if EVENT_DELTA_TYPE_COUNT > 0
+		uint32_t write_index = (EXTENDED_DATA_COPIED == kind) ?
+		                       write_extended_payload(queue, queue->payload_write_index, event_data, data_length,
+		                                              mapped_data) :
+		                       write_delta_payload(queue, queue->payload_write_index, kind, stored_data);
+#else
+		uint32_t write_index = write_extended_payload(queue, queue->payload_write_index, event_data, data_length,
+		                                              mapped_data);
+#endif // EVENT_DELTA_TYPE_COUNT > 0
+#if OFFER_TIMESTAMPS == 1
+		queue->timestamps[queue->timestamp_write_index] = EVENT_TIMESTAMP();
+#endif // OFFER_TIMESTAMPS == 1
+		send_status = tx_queue_send(&queue->queue, &event_message, TX_NO_WAIT);
+		if (TX_SUCCESS != send_status) {
+			offer_status = JFALSE;
+		} else {
+			queue->payload_write_index = write_index;
+#if OFFER_TIMESTAMPS == 1
+			record_sent_event(queue);
+#endif // OFFER_TIMESTAMPS == 1
+#if EVENT_DELTA_TYPE_COUNT > 0
+			if (EXTENDED_DATA_COPIED != kind) {
+				set_delta_reference(kind, event_data, data_length);
+			}
+#endif // EVENT_DELTA_TYPE_COUNT > 0
+		}
+	}
+
+	// If a Java thread is waiting to read an event, notify it once out of the critical section.
+	int32_t java_thread_id = SNI_ERROR;
+	if (offer_status == (jboolean)JTRUE) {
+		java_thread_id = take_java_thread_to_wake(&event_consumers[queue->consumer], 1u, is_type_urgent(type));
+	}
+	LLEVENT_TRACE_RECORD((offer_status == (jboolean)JTRUE) ? LLEVENT_TRACE_EVENT_OFFER : LLEVENT_TRACE_EVENT_QUEUE_FULL,
+	                     event_message, event_types[type].priority);
+	if ((offer_status == (jboolean)JTRUE) && (NULL != mapped_data)) {
+		// The data of a mapped event may be released by the Java thread as soon as the critical section is left.
+		LLEVENT_REPLAY_RECORD(event_message, data);
+	}
+#if EVENT_INSTRUMENTATION == 1
+	if ((offer_status == (jboolean)JTRUE) || ((flags & OFFER_RETRIED) == 0u)) {
+		LLEVENT_STATISTICS_record_offer(type, offer_status == (jboolean)JTRUE);
+	}
+#endif // EVENT_INSTRUMENTATION == 1
+#if EVENT_OVERFLOW_POLICY_SUPPORT == 1
+	if ((offer_status == (jboolean)JFALSE) && ((flags & OFFER_RETRIED) == 0u)) {
+		count_dropped_event(type);
+	}
+#endif // EVENT_OVERFLOW_POLICY_SUPPORT == 1
+
+	// Leave the critical section after sending the extended event.
+	event_queue_unlock(lock_state);
+
+	// Record the event out of the critical section, so that the copy of its data does not delay the other producers.
+	if ((offer_status == (jboolean)JTRUE) && (NULL == mapped_data)) {
+		LLEVENT_REPLAY_RECORD(event_message, data);
+	}
+
+	// Trace the failure out of the critical section, where the interrupts may be disabled. A full queue is reported
+	// by the returned status only.
+	if ((TX_SUCCESS != send_status) && (TX_QUEUE_FULL != send_status) &&
+	    ((flags & (OFFER_FROM_ISR | OFFER_RETRIED)) == 0u)) {
+		LLEVENT_ERROR_TRACE("during tx_queue_send ; status = 0x%x \n", send_status);
+	}
+
+	resume_waiting_java_thread(&event_consumers[queue->consumer], java_thread_id, from_isr);
+
+	return offer_status;
+}
+
+/**
+ * Offers a batch of events to the queue of their priority within a single critical section. The space of all the
+ * events is checked first, so that the batch is sent completely or not at all, without events of other producers in
+ * between.
+ *
+ * @param events the events of the batch, all of the same priority.
+ * @param count the number of events, between 1 and LLEVENT_BATCH_MAX_EVENTS.
+ * @param flags the OFFER_* flags of the offer.
+ * @return true if all the events have been sent, false if none has been sent.
+ */
+static bool offer_events(const LLEVENT_batch_event_t* events, uint32_t count, uint32_t flags) {
+	bool from_isr = (flags & OFFER_FROM_ISR) != 0u;
+	event_queue_t* queue = &event_queues[event_types[events[0].type].priority];
+	// Filter the events before entering the critical section.
+	uint32_t kept_events = filter_batch_events(events, count);
+
+	// The size of the events of the batch that have not been discarded.
+	uint32_t payload_words = 0;
+	uint32_t kept_count = 0;
+	for (uint32_t i = 0; i < count; i++) {
+		if ((kept_events & ((uint32_t)1u << i)) != 0u) {
+			if (NULL != events[i].extended_data) {
+				payload_words += get_extended_event_words((uint32_t)events[i].data, NULL);
+			}
+			kept_count++;
+		}
+	}
+	int32_t java_thread_id = SNI_ERROR;
+
+	// Enter the critical section before checking the space and sending the events.
+	UINT lock_state = event_queue_lock();
+
+	ULONG available_storage = 0;
+	// Unused return value: the queue is valid.
+	UINT status = tx_queue_info_get(&queue->queue, TX_NULL, TX_NULL, &available_storage, TX_NULL, TX_NULL, TX_NULL);
+	(void)status;
+	bool offer_status = ((ULONG)kept_count <= available_storage) &&
+	                    (payload_words <= get_payload_free_words(queue, queue->payload_write_index));
+	if (offer_status && (0u != kept_count)) {
+		for (uint32_t i = 0; i < count; i++) {
+			if ((kept_events & ((uint32_t)1u << i)) != 0u) {
+				uint32_t event_message = get_batch_event_message(&events[i]);
+				uint32_t write_index = queue->payload_write_index;
+				if (NULL != events[i].extended_data) {
+					// cppcheck-suppress [misra-c2012-11.5]: conversion from void* to uint8_t* necessary to copy the input
+					// data.
+					write_index = write_extended_payload(queue, write_index, (const uint8_t*)events[i].extended_data,
+					                                     (uint32_t)events[i].data, NULL);
+				}
+#if OFFER_TIMESTAMPS == 1
+				queue->timestamps[queue->timestamp_write_index] = EVENT_TIMESTAMP();
+#endif // OFFER_TIMESTAMPS == 1
+				// Unused return value: the space has been checked within the critical section.
+				status = tx_queue_send(&queue->queue, &event_message, TX_NO_WAIT);
+				(void)status;
+				queue->payload_write_index = write_index;
+#if OFFER_TIMESTAMPS == 1
+				record_sent_event(queue);
+#endif // OFFER_TIMESTAMPS == 1
+				LLEVENT_TRACE_RECORD(LLEVENT_TRACE_EVENT_OFFER, event_message, event_types[events[i].type].priority);
+			}
+		}
+		// If a Java thread is waiting to read an event, notify it once for the batch.
+		java_thread_id = take_java_thread_to_wake(&event_consumers[queue->consumer], kept_count,
+		                                          is_batch_urgent(events, count, kept_events));
+	} else if (!offer_status) {
+		LLEVENT_TRACE_RECORD(LLEVENT_TRACE_EVENT_QUEUE_FULL, get_batch_event_message(&events[0]),
+		                     event_types[events[0].type].priority);
+	} else {
+		// All the events of the batch have been discarded.
+	}
+#if EVENT_INSTRUMENTATION == 1
+	record_batch_offer(events, count, kept_events, offer_status);
+#endif // EVENT_INSTRUMENTATION == 1
+#if EVENT_OVERFLOW_POLICY_SUPPORT == 1
+	if (!offer_status) {
+		count_dropped_batch(events, count, kept_events);
+	}
+#endif // EVENT_OVERFLOW_POLICY_SUPPORT == 1
+
+	// Leave the critical section after sending the events.
+	event_queue_unlock(lock_state);
+
+#if EVENT_REPLAY_LOG_SUPPORT == 1
+	// Record the events out of the critical section, so that the copy of the records does not delay the other
+	// producers.
+	if (offer_status) {
+		record_batch_events(events, count, kept_events);
+	}
+#endif // EVENT_REPLAY_LOG_SUPPORT == 1
+
+	resume_waiting_java_thread(&event_consumers[queue->consumer], java_thread_id, from_isr);
+
+	return offer_status;
+}
+
+/**
+ * Fetches an event from the queue of a priority, without waiting.
+ *
+ * @param consumer the consumer of the queue.
+ * @param priority the priority of the queue.
+ * @param event_message the destination of the event.
+ * @return TX_SUCCESS if an event has been fetched, TX_QUEUE_EMPTY if the queue is empty.
+ */
+static UINT receive_queue_event(event_consumer_t* consumer, uint32_t priority, uint32_t* event_message) {
+	event_queue_t* queue = &event_queues[priority];
+	UINT status = tx_queue_receive(&queue->queue, event_message, TX_NO_WAIT);
+	if (TX_SUCCESS == status) {
+#if OFFER_TIMESTAMPS == 1
+		uint32_t timestamp_index = queue->timestamp_read_index;
+#if EVENT_INSTRUMENTATION == 1
+		LLEVENT_STATISTICS_record_latency(EVENT_TIMESTAMP() - queue->timestamps[timestamp_index]);
+#endif // EVENT_INSTRUMENTATION == 1
+#if EVENT_TIMESTAMP_SUPPORT == 1
+		consumer->reader.event_timestamp = queue->timestamps[timestamp_index];
+#endif // EVENT_TIMESTAMP_SUPPORT == 1
+		timestamp_index++;
+		queue->timestamp_read_index = (timestamp_index == queue->timestamp_count) ? 0u : timestamp_index;
+#endif // OFFER_TIMESTAMPS == 1
+#if EVENT_BLOCKING_OFFER_SUPPORT == 1
+		notify_space_available();
+#endif // EVENT_BLOCKING_OFFER_SUPPORT == 1
+#if EVENT_COALESCING_SUPPORT == 1
+		*event_message = take_coalesced_event(*event_message);
+#endif // EVENT_COALESCING_SUPPORT == 1
+		LLEVENT_TRACE_RECORD(LLEVENT_TRACE_EVENT_DEQUEUE, *event_message, priority);
+		// Remember the queue in case of an extended event, its data is in the payload buffer of this queue.
+		consumer->reader.reading_queue = queue;
+	}
+	return status;
+}
+
+/**
+ * Releases the words of the extended event being read in constant time.
+ */
+static void release_payload_event(event_reader_t* reader) {
+	reader->reading_queue->payload_read_index = reader->payload_event_release_index;
+#if EVENT_BLOCKING_OFFER_SUPPORT == 1
+	notify_space_available();
+#endif // EVENT_BLOCKING_OFFER_SUPPORT == 1
+}
+
+#endif // EVENT_LOCK_FREE_QUEUE == 1
+
+/**
+ * Fetches an event from the queues of a consumer, from the highest priority to the lowest, without waiting.
+ * The first word of an extended event is released, its data words are released by
+ * LLEVENT_IMPL_end_read_extended_data().
+ *
+ * @param consumer the consumer of the queues.
+ * @param event_message the destination of the event.
+ * @return TX_SUCCESS if an event has been fetched, TX_QUEUE_EMPTY if all the queues are empty.
+ */
+static UINT receive_event(event_consumer_t* consumer, uint32_t* event_message) {
+	UINT status = TX_QUEUE_EMPTY;
+	for (uint32_t i = (uint32_t)EVENT_QUEUE_COUNT; (i > 0u) && (TX_SUCCESS != status); i--) {
+		// The queues dispatched by another consumer are skipped.
+		if (&event_consumers[event_queues[i - 1u].consumer] == consumer) {
+			status = receive_queue_event(consumer, i - 1u, event_message);
+		}
+	}
+	return status;
+}
+
+/**
+ * Reads the next byte of data from the payload buffer of reading_queue.
+ */
+static jbyte read_payload_byte(event_reader_t* reader) {
+	jbyte read_byte = JTRUE;
+	// If less than one byte available, throw a native IOException.
+	if (get_available_bytes(reader) < sizeof(jbyte)) {
+		if (SNI_throwNativeIOException(EVENT_NOK, "No byte remaining in the extended data.") == SNI_ERROR) {
+			LLEVENT_ERROR_TRACE("during EventDataReader reading: No byte remaining in the extended data.\n");
+			LLEVENT_ERROR_TRACE(
+				"This function is not called within the virtual machine task or if the current thread is suspended.\n");
+		}
+		read_byte = JFALSE;
+	}
+
+	if (read_byte == JTRUE) {
+		struct int_to_byte_t {
+			jbyte first_byte;
+			jbyte second_byte;
+			jbyte third_byte;
+			jbyte fourth_byte;
+		};
+
+		// If the 4 bytes buffer is empty (offset == -1) or has been fully read (offset >= 4), read the next uint32_t of
+		// data from the event_queue.
+		if ((reader->offset_buffer_extended_data == (int8_t)-1) || (reader->offset_buffer_extended_data >= (int8_t)4)) {
+			// Fetch a message from the queue and store it in the 4 bytes buffer. Suspend the thread if no message
+			// available.
+			UINT status = payload_receive(reader, &reader->buffer_extended_data);
+			if (TX_SUCCESS != status) {
+				if (SNI_throwNativeIOException(EVENT_NOK, "No more data on the message queue.") == SNI_ERROR) {
+					LLEVENT_ERROR_TRACE("during EventDataReader reading: No more data on the message queue.\n");
+					LLEVENT_ERROR_TRACE(
+						"This function is not called within the virtual machine task or if the current thread is suspended.\n");
+				}
+				read_byte = JFALSE;
+			} else {
+				// Set the offset of the buffer to 0 -> 0 byte has been read.
+				reader->offset_buffer_extended_data = 0;
+				// Switch the alignment
+				reader->data_alignment = reader->data_alignment == (uint8_t)0 ? 1 : 0;
+			}
+		}
+
+		// Process the data if there is no error during SNI_suspendCurrentJavaThreadWithCallback
+		if (read_byte == JTRUE) {
+			// Get the next byte of data from the 4 bytes buffer.
+			// IAR does not allow direct conversion from uint32_t* into int_to_byte_t*, intermediate data required.
+			struct int_to_byte_t int_to_byte_data;
+			struct int_to_byte_t* int_to_byte_ptr = &int_to_byte_data;
+			int_to_byte_ptr->first_byte = (reader->buffer_extended_data & BYTE_ONE_MASK);
+			int_to_byte_ptr->second_byte = (((reader->buffer_extended_data & BYTE_TWO_MASK) >> BYTE_TWO_SHIFT));
+			int_to_byte_ptr->third_byte = (((reader->buffer_extended_data & BYTE_THREE_MASK) >> BYTE_THREE_SHIFT));
+			int_to_byte_ptr->fourth_byte = (((reader->buffer_extended_data & BYTE_FOUR_MASK) >> BYTE_FOUR_SHIFT));
+
+			if (reader->offset_buffer_extended_data == (int8_t)0) {
+				read_byte = int_to_byte_ptr->first_byte;
+			} else if (reader->offset_buffer_extended_data == (int8_t)1) {
+				read_byte = int_to_byte_ptr->second_byte;
+			} else if (reader->offset_buffer_extended_data == (int8_t)2) {
+				read_byte = int_to_byte_ptr->third_byte;
+			} else {
+				read_byte = int_to_byte_ptr->fourth_byte;
+			}
+			// Increment the offset of the 4 bytes buffer.
+			reader->offset_buffer_extended_data++;
+			// Increment the offset of the data read.
+			reader->offset_extended_data_read++;
+		}
+	}
+
+	return read_byte;
+}
+
+/**
+ * Reads the next short of data from the payload buffer of reading_queue.
+ */
+static jshort read_payload_short(event_reader_t* reader) {
+	jshort event_short = JTRUE;
+	// If less than 2 bytes available, throw a native IOException.
+	if (get_available_bytes(reader) < sizeof(jshort)) {
+		if (SNI_throwNativeIOException(EVENT_NOK, "Less than two bytes remaining in the extended data.") == SNI_ERROR) {
+			LLEVENT_ERROR_TRACE(
+				"during EventDataReader reading: Less than two bytes remaining in the extended data.\n");
+			LLEVENT_ERROR_TRACE(
+				"This function is not called within the virtual machine task or if the current thread is suspended.\n");
+		}
+		event_short = JFALSE;
+	}
+
+	if (event_short == JTRUE) {
+		struct int_to_short_t {
+			jshort first_short;
+			jshort second_short;
+		};
+
+		// If the 4 bytes buffer is empty (offset == -1) or has no char remaining (offset >= 3), read the next uint32_t
+		// of data from the event_queue.
+		if ((reader->offset_buffer_extended_data == (int8_t)-1) || (reader->offset_buffer_extended_data >= (int8_t)3)) {
+			// If offset equals 3, an alignment is done -> increase the offset_extended_data_read.
+			if (reader->offset_buffer_extended_data == (int8_t)3) {
+				reader->offset_extended_data_read++;
+			}
+
+			// Fetch a message from the queue and store it in the 4 bytes buffer. Suspend the thread if no message
+			// available.
+			UINT status = payload_receive(reader, &reader->buffer_extended_data);
+			if (TX_SUCCESS != status) {
+				if (SNI_throwNativeIOException(EVENT_NOK, "No more data on the message queue.") == SNI_ERROR) {
+					LLEVENT_ERROR_TRACE("during EventDataReader reading: No more data on the message queue.\n");
+					LLEVENT_ERROR_TRACE(
+						"This function is not called within the virtual machine task or if the current thread is suspended.\n");
+				}
+				event_short = JFALSE;
+			} else {
+				// Set the offset of the buffer to 0 -> 0 byte has been read.
+				reader->offset_buffer_extended_data = 0;
+				// Switch the alignment
+				reader->data_alignment = reader->data_alignment == (uint8_t)0 ? 1 : 0;
+			}
+		}
+
+		// Process the data if there is no error during SNI_suspendCurrentJavaThreadWithCallback
+		if (event_short == JTRUE) {
+			// Check if the buffer is 2 byte aligned. If the offset is equal to 1 -> aligned to 2.
+			// The other possible values are 0 or 2 (if 3 a new uint32_t is read from the queue), in those cases the
+			// buffer is aligned.
+			// If an alignment is done, increase the offset_extended_data_read.
+			if (reader->offset_buffer_extended_data == (int8_t)1) {
+				reader->offset_buffer_extended_data = 2;
+				reader->offset_extended_data_read++;
+			}
+			// Get the two next bytes of data from the 4 bytes buffer.
+			// IAR does not allow direct conversion from uint32_t* into int_to_short_t*, intermediate data required.
+			struct int_to_short_t int_to_short_data;
+			struct int_to_short_t* int_to_short_ptr = &int_to_short_data;
+
+			int_to_short_ptr->first_short = (reader->buffer_extended_data & SHORT_ONE_MASK);
+			int_to_short_ptr->second_short = (((reader->buffer_extended_data & SHORT_TWO_MASK)) >> SHORT_TWO_SHIFT);
+
+			if (reader->offset_buffer_extended_data == (int8_t)0) {
+				event_short = int_to_short_ptr->first_short;
+			} else {
+				event_short = int_to_short_ptr->second_short;
+			}
+			// Increment the offset of the 4 bytes buffer.
+			reader->offset_extended_data_read += sizeof(jshort);
+			//Increment the offset of the data read.
+			reader->offset_buffer_extended_data += (int8_t)sizeof(jshort);
+		}
+	}
+	return event_short;
+}
+
+/**
+ * Reads the next int of data from the payload buffer of reading_queue.
+ */
+static jint read_payload_int(event_reader_t* reader) {
+	jint event_int = JTRUE;
+	// If less than 4 bytes available, throw a native IOException.
+	if (get_available_bytes(reader) < sizeof(jint)) {
+		if (SNI_throwNativeIOException(EVENT_NOK,
+		                               "Less than four bytes remaining in the extended data.") == SNI_ERROR) {
+			LLEVENT_ERROR_TRACE(
+				"during EventDataReader reading: Less than four bytes remaining in the extended data.\n");
+			LLEVENT_ERROR_TRACE(
+				"This function is not called within the virtual machine task or if the current thread is suspended.\n");
+		}
+		event_int = JFALSE;
+	}
+
+	if (event_int == JTRUE) {
+		// Aligned = 4 -> read a new integer from the queue and delete the buffer (padding).
+		// If there was data in the buffer -> add the skipped bytes to the offset.
+		// There is data if the buffer is not empty (offset != -1) and everything has not been handled (offset < 4).
+		if ((reader->offset_buffer_extended_data != (int8_t)-1) && (reader->offset_buffer_extended_data < (int8_t)4)) {
+			reader->offset_extended_data_read += sizeof(jint) - (uint8_t)reader->offset_buffer_extended_data;
+		}
+		// Reset the buffer used to read bytes of an extended event.
+		reader->buffer_extended_data = (uint32_t)NULL;
+		reader->offset_buffer_extended_data = (int8_t)-1;
+
+		// Fetch a message from the queue. Suspend the thread if no message available.
+		UINT status = payload_receive(reader, &event_int);
+		if (TX_SUCCESS != status) {
+			if (SNI_throwNativeIOException(EVENT_NOK, "No more data on the message queue.") == SNI_ERROR) {
+				LLEVENT_ERROR_TRACE("during EventDataReader reading: No more data on the message queue.\n");
+				LLEVENT_ERROR_TRACE(
+					"This function is not called within the virtual machine task or if the current thread is suspended.\n");
+			}
+			event_int = JFALSE;
+		} else {
+			// Increment the offset of the data read.
+			reader->offset_extended_data_read += sizeof(jint);
+			// Switch the alignment
+			reader->data_alignment = reader->data_alignment == (uint8_t)0 ? 1 : 0;
+		}
+	}
+	return event_int;
+}
+
+/**
+ * Reads the next long of data from the payload buffer of reading_queue.
+ */
+static jlong read_payload_long(event_reader_t* reader) {
+	// Method status
+	jboolean read_status = JTRUE;
+	jlong return_value = 0;
+	// If less than 8 bytes available (or 4 bytes if the first par of the long value has been read), throw a native
+	// IOException.
+	if (get_available_bytes(reader) < sizeof(jlong)) {
+		if (SNI_throwNativeIOException(EVENT_NOK,
+		                               "Less than eight bytes remaining in the extended data.") == SNI_ERROR) {
+			LLEVENT_ERROR_TRACE(
+				"during EventDataReader reading: Less than eight bytes remaining in the extended data.\n");
+			LLEVENT_ERROR_TRACE(
+				"This function is not called within the virtual machine task or if the current thread is suspended.\n");
+		}
+		read_status = JFALSE;
+	}
+
+	if (read_status == (jboolean)JTRUE) {
+		// cppcheck-suppress [misra-c2012-19.2]: the union keyword here is useful to parse the data structure.
+		union {
+			jint int_values[2];
+			jlong long_value;
+		} event_long; // cppcheck-suppress [misra-c2012-19.2]: the union keyword here is useful to parse the data
+		              // structure.
+
+		jint event_value = 0;
+		// The first part of the long value, kept until the second part is read.
+		jint first_long_value = 0;
+
+		// Aligned = 8 -> delete the buffer (padding).
+		// If there was data in the buffer -> add the skipped bytes to the offset.
+		// There is data if the buffer is not empty (offset != -1) and everything has not been handled (offset < 4).
+		if ((reader->offset_buffer_extended_data != (int8_t)-1) && (reader->offset_buffer_extended_data < (int8_t)4)) {
+			reader->offset_extended_data_read += sizeof(jint) - (uint8_t)reader->offset_buffer_extended_data;
+		}
+		// Reset the buffer used to read bytes of an extended event.
+		reader->buffer_extended_data = (uint32_t)NULL;
+		reader->offset_buffer_extended_data = (int8_t)-1;
+
+		// If the data is not 8 bytes aligned, skip 4 bytes from the queue.
+		if (reader->data_alignment != (uint8_t)1) {
+			UINT status = payload_receive(reader, &event_value);
+			if (TX_SUCCESS != status) {
+				if (SNI_throwNativeIOException(EVENT_NOK, "No more data on the message queue.") == SNI_ERROR) {
+					LLEVENT_ERROR_TRACE("during EventDataReader reading: No more data on the message queue.\n");
+					LLEVENT_ERROR_TRACE(
+						"This function is not called within the virtual machine task or if the current thread is suspended.\n");
+				}
+				read_status = JFALSE;
+			} else {
+				// Increment the offset of the data read.
+				reader->offset_extended_data_read += sizeof(jint);
+				// Switch the alignment
+				reader->data_alignment = reader->data_alignment == (uint8_t)0 ? 1 : 0;
+			}
+		}
+		// Continue to read the eight bytes if there is no error during alignment reading.
+		if (read_status == (jboolean)JTRUE) {
+			// Read the first part of the long.
+			UINT status = payload_receive(reader, &event_value);
+			if (TX_SUCCESS != status) {
+				if (SNI_throwNativeIOException(EVENT_NOK, "No more data on the message queue.") == SNI_ERROR) {
+					LLEVENT_ERROR_TRACE("during EventDataReader reading: No more data on the message queue.\n");
+					LLEVENT_ERROR_TRACE(
+						"This function is not called within the virtual machine task or if the current thread is suspended.\n");
+				}
+				read_status = JFALSE;
+			} else {
+				// Increment the offset of the data read.
+				reader->offset_extended_data_read += sizeof(jint);
+				// Keep the first part of the long.
+				first_long_value = event_value;
+				// Switch the alignment
+				reader->data_alignment = reader->data_alignment == (uint8_t)0 ? 1 : 0;
+			}
+			// Continue to read the eight bytes if there is no error during pervious call to
+			// SNI_suspendCurrentJavaThreadWithCallback
+			if (read_status == (jboolean)JTRUE) {
+				// Get the second part of the long. Suspend the thread if no message available.
+				UINT status = payload_receive(reader, &event_value);
+				if (TX_SUCCESS != status) {
+					if (SNI_throwNativeIOException(EVENT_NOK, "No more data on the message queue.") == SNI_ERROR) {
+						LLEVENT_ERROR_TRACE("during EventDataReader reading: No more data on the message queue.\n");
+						LLEVENT_ERROR_TRACE(
+							"This function is not called within the virtual machine task or if the current thread is suspended.\n");
+					}
+				} else {
+					// Increment the offset of the data read.
+					reader->offset_extended_data_read += sizeof(jint);
+					// Switch the alignment
+					reader->data_alignment = reader->data_alignment == (uint8_t)0 ? 1 : 0;
+					// Convert the two int32_t to a long value (64 bits).
+					event_long.int_values[0] = first_long_value;
+					event_long.int_values[1] = event_value;
+					return_value = event_long.long_value;
+				}
+			}
+		}
+	}
+
+	return return_value;
+}
+
+/**
+ * Reads the next byte of data of a reader, from its staging buffer or from the payload buffer of reading_queue.
+ */
+static jbyte reader_read_byte(event_reader_t* reader) {
+#if EVENT_READ_STAGING_BUFFER_SIZE > 0
+	jbyte read_byte;
+	uint32_t offset;
+	if (0u == reader->staged_words) {
+		read_byte = read_payload_byte(reader);
+	} else if (take_staged_value(reader, (uint32_t)sizeof(jbyte), &offset)) {
+		read_byte = (jbyte)(get_staged_word(reader, offset) & BYTE_ONE_MASK);
+	} else {
+		read_byte = JFALSE;
+	}
+	return read_byte;
+#else
+	return read_payload_byte(reader);
+#endif // EVENT_READ_STAGING_BUFFER_SIZE > 0
+}
+
+/**
+ * Reads the next short of data of a reader, from its staging buffer or from the payload buffer of reading_queue.
+ */
+static jshort reader_read_short(event_reader_t* reader) {
+#if EVENT_READ_STAGING_BUFFER_SIZE > 0
+	jshort event_short;
+	uint32_t offset;
+	if (0u == reader->staged_words) {
+		event_short = read_payload_short(reader);
+	} else if (take_staged_value(reader, (uint32_t)sizeof(jshort), &offset)) {
+		event_short = (jshort)(get_staged_word(reader, offset) & SHORT_ONE_MASK);
+	} else {
+		event_short = JFALSE;
+	}
+	return event_short;
+#else
+	return read_payload_short(reader);
+#endif // EVENT_READ_STAGING_BUFFER_SIZE > 0
+}
+
+/**
+ * Reads the next int of data of a reader, from its staging buffer or from the payload buffer of reading_queue.
+ */
+static jint reader_read_int(event_reader_t* reader) {
+#if EVENT_READ_STAGING_BUFFER_SIZE > 0
+	jint event_int;
+	uint32_t offset;
+	if (0u == reader->staged_words) {
+		event_int = read_payload_int(reader);
+	} else if (take_staged_value(reader, (uint32_t)sizeof(jint), &offset)) {
+		event_int = (jint)reader->staging_buffer[offset / (uint32_t)sizeof(uint32_t)];
+	} else {
+		event_int = JFALSE;
+	}
+	return event_int;
+#else
+	return read_payload_int(reader);
+#endif // EVENT_READ_STAGING_BUFFER_SIZE > 0
+}
+
+/**
+ * Reads the next long of data of a reader, from its staging buffer or from the payload buffer of reading_queue.
+ */
+static jlong reader_read_long(event_reader_t* reader) {
+#if EVENT_READ_STAGING_BUFFER_SIZE > 0
+	jlong return_value = 0;
+	uint32_t offset;
+	if (0u == reader->staged_words) {
+		return_value = read_payload_long(reader);
+	} else if (take_staged_value(reader, (uint32_t)sizeof(jlong), &offset)) {
+		// cppcheck-suppress [misra-c2012-19.2]: the union keyword here is useful to parse the data structure.
+		union {
+			jint int_values[2];
+			jlong long_value;
+		} event_long; // cppcheck-suppress [misra-c2012-19.2]: the union keyword here is useful to parse the data
+		              // structure.
+		// Same word order as the values read from the payload buffer.
+		event_long.int_values[0] = (jint)reader->staging_buffer[offset / (uint32_t)sizeof(uint32_t)];
+		event_long.int_values[1] = (jint)reader->staging_buffer[(offset / (uint32_t)sizeof(uint32_t)) + 1u];
+		return_value = event_long.long_value;
+	} else {
+		// IOException thrown.
+	}
+	return return_value;
+#else
+	return read_payload_long(reader);
+#endif // EVENT_READ_STAGING_BUFFER_SIZE > 0
+}
+
+#if EVENT_DELTA_TYPE_COUNT > 0
+
+/**
+ * Reads a delta-encoded extended event from the payload buffer of reading_queue and decodes it into the references of
+ * its type, whose data the extended event is then read from. An event that does not match the previous extended event
+ * of its type (e.g. read out of order) is read with no data available, so that the reads of the Java listener throw an
+ * IOException, and the delta events of the type that follow are not decoded until the next reference.
+ *
+ * @param reader the reader of the extended event, whose kind of data has been read.
+ * @param kind the kind of data, EXTENDED_DATA_REFERENCE or EXTENDED_DATA_DELTA.
+ * @param data_length the number of bytes of data of the extended event.
+ */
+static void read_delta_event(event_reader_t* reader, uint32_t kind, uint32_t data_length) {
+	delta_reference_t* reference = &delta_references[(kind >> DELTA_REFERENCE_SHIFT) & DELTA_KIND_MASK];
+	uint32_t stored_length = get_delta_stored_length(kind);
+	uint32_t stored_words = LLEVENT_FRAMING_get_payload_words(stored_length);
+	reader->payload_event_end_index = get_payload_index(reader->reading_queue, reader->payload_event_read_index,
+	                                                    stored_words);
+	bool decoded;
+	if (EXTENDED_DATA_REFERENCE == (kind & DELTA_KIND_MASK)) {
+		(void)payload_read_words(reader, (uint8_t*)reference->decoded_data, stored_words);
+		reference->decoded_length = stored_length;
+		decoded = stored_length == data_length;
+	} else {
+		(void)payload_read_words(reader, (uint8_t*)delta_decoding_buffer, stored_words);
+		decoded = (reference->decoded_length == data_length) &&
+		          decode_delta((uint8_t*)reference->decoded_data, data_length, (const uint8_t*)delta_decoding_buffer,
+		                       stored_length);
+	}
+	if (!decoded) {
+		LLEVENT_ERROR_TRACE("during read_delta_event ; the extended event does not match its reference \n");
+		reference->decoded_length = DELTA_NO_REFERENCE;
+		reader->data_length_extended_data = 0;
+	}
+
+	// Read the decoded data, without giving it back once read.
+	reader->payload_event_release_index = reader->payload_event_end_index;
+	reader->reading_mapped_data.data = (uint8_t*)reference->decoded_data;
+	reader->reading_mapped_data.release = NULL;
+	reader->payload_event_read_index = 0;
+	reader->payload_event_end_index = LLEVENT_FRAMING_get_payload_words(data_length);
+}
+
+#endif // EVENT_DELTA_TYPE_COUNT > 0
+
+/**
+ * Starts the read of the extended event fetched last by a reader: sets the indexes of its data in the payload buffer
+ * of reading_queue (or reads its mapping, or decodes it) and resets the offset of the read.
+ */
+static void start_read_extended_data(event_reader_t* reader, uint32_t data_length) {
+	reader->data_length_extended_data = data_length;
+	reader->offset_extended_data_read = 0;
+
+	// The data of the extended event starts at the read index of the payload buffer of its queue.
+	reader->payload_event_read_index = reader->reading_queue->payload_read_index;
+#if (EVENT_MAPPED_DATA_SUPPORT == 1) || (EVENT_DELTA_TYPE_COUNT > 0)
+	// Read the kind of data first.
+	uint32_t kind = EXTENDED_DATA_COPIED;
+	reader->payload_event_end_index = get_payload_index(reader->reading_queue, reader->payload_event_read_index, 1u);
+	(void)payload_receive(reader, &kind);
+#if EVENT_DELTA_TYPE_COUNT > 0
+	if ((EXTENDED_DATA_REFERENCE == (kind & DELTA_KIND_MASK)) || (EXTENDED_DATA_DELTA == (kind & DELTA_KIND_MASK))) {
+		read_delta_event(reader, kind, data_length);
+	} else
+#endif // EVENT_DELTA_TYPE_COUNT > 0
+	if (EXTENDED_DATA_MAPPED == kind) {
+		// Read the mapping, then read the data from the buffer of the producer.
+		uint32_t mapping_words = LLEVENT_FRAMING_get_payload_words((uint32_t)sizeof(mapped_data_t));
+		reader->payload_event_end_index = get_payload_index(reader->reading_queue, reader->payload_event_read_index, mapping_words);
+		(void)payload_read_words(reader, (uint8_t*)&reader->reading_mapped_data, mapping_words);
+		reader->payload_event_release_index = reader->payload_event_end_index;
+		reader->payload_event_read_index = 0;
+		reader->payload_event_end_index = LLEVENT_FRAMING_get_payload_words(data_length);
+	} else
+#endif // (EVENT_MAPPED_DATA_SUPPORT == 1) || (EVENT_DELTA_TYPE_COUNT > 0)
+	{
+		reader->payload_event_end_index = get_payload_index(reader->reading_queue, reader->payload_event_read_index,
+		                                            LLEVENT_FRAMING_get_payload_words(data_length));
+		reader->payload_event_release_index = reader->payload_event_end_index;
+	}
+
+	reader->data_alignment = 1;
+}
+
+/**
+ * Ends the read of the extended event of a reader: releases its words in the payload buffer and gives its mapped data
+ * back to its producer.
+ */
+static void end_read_extended_data(event_reader_t* reader) {
+	// If there is still extended data inside the payload buffer, purge it: release all the words of the extended event.
+	release_payload_event(reader);
+#if (EVENT_MAPPED_DATA_SUPPORT == 1) || (EVENT_DELTA_TYPE_COUNT > 0)
+	// Give the mapped data back to its producer.
+	if (NULL != reader->reading_mapped_data.data) {
+		if (NULL != reader->reading_mapped_data.release) {
+			reader->reading_mapped_data.release(reader->reading_mapped_data.data, reader->reading_mapped_data.release_arg);
+		}
+		reader->reading_mapped_data.data = NULL;
+	}
+#endif // (EVENT_MAPPED_DATA_SUPPORT == 1) || (EVENT_DELTA_TYPE_COUNT > 0)
+
+	// reset the data length and the offset.
+	reader->data_length_extended_data = 0;
+	reader->offset_extended_data_read = 0;
+	// reset the buffer used to read bytes of an extended event.
+	reader->buffer_extended_data = (uint32_t)NULL;
+	reader->offset_buffer_extended_data = -1;
+#if EVENT_READ_STAGING_BUFFER_SIZE > 0
+	reader->staged_words = 0;
+#endif // EVENT_READ_STAGING_BUFFER_SIZE > 0
+}
+
+#if (EVENT_PRODUCER_LANE_COUNT > 0) || (EVENT_OVERFLOW_POLICY_SUPPORT == 1)
+
+/**
+ * Checks whether an extended event fits in the empty payload buffer of its queue, one word always left empty: an event
+ * of a producer lane or of the overflow ring that does not would never leave it.
+ *
+ * @param queue the queue of the event.
+ * @param data_length the number of bytes of data.
+ */
+static bool fits_in_payload_buffer(const event_queue_t* queue, uint32_t data_length) {
+#if EVENT_LOCK_FREE_QUEUE == 1
+	// The first word of the event is stored with its data.
+	uint32_t words = get_extended_event_words(data_length, NULL) + 1u;
+#else
+	uint32_t words = get_extended_event_words(data_length, NULL);
+#endif // EVENT_LOCK_FREE_QUEUE == 1
+	return words < queue->payload_buffer_words;
+}
+
+/**
+ * Offers an event read from a producer lane or from the overflow ring to its queue. A full queue is not reported: the
+ * event stays in the ring until space is available.
+ *
+ * @return true if the event has been sent, false if it does not fit in its queue.
+ */
+static bool offer_ring_event(const LLEVENT_amp_event_t* event) {
+	bool offer_status;
+	if (event->extended) {
+		offer_status = offer_extended_event((uint32_t)event->type, event->extended_data, event->data, NULL,
+		                                    OFFER_RETRIED);
+	} else {
+		offer_status = offer_event((uint32_t)event->type, event->data, OFFER_RETRIED);
+	}
+	return offer_status;
+}
+
+#endif // (EVENT_PRODUCER_LANE_COUNT > 0) || (EVENT_OVERFLOW_POLICY_SUPPORT == 1)
+
+#if EVENT_OVERFLOW_POLICY_SUPPORT == 1
+
+/**
+ * Checks whether the overflow ring holds events not moved into their queues yet.
+ */
+static bool is_overflow_ring_empty(void) {
+	return atomic_load(&overflow_ring.write_index) == atomic_load(&overflow_ring.read_index);
+}
+
+/**
+ * Writes an event into the overflow ring. Must be called with the interrupts disabled: the producers write the ring
+ * one at a time.
+ *
+ * @return true if the event has been written, false if the ring is full.
+ */
+static bool write_overflow_event(uint32_t type, uint32_t data, const void* extended_data) {
+	bool written;
+	if (NULL != extended_data) {
+		written = LLEVENT_AMP_offer_extended_event(&overflow_ring, (int32_t)type, extended_data, data);
+	} else {
+		written = LLEVENT_AMP_offer_event(&overflow_ring, (int32_t)type, (int32_t)data);
+	}
+	return written;
+}
+
+/**
+ * Discards the oldest event of the overflow ring to make room for a spilled event of the LLEVENT_OVERFLOW_DROP_OLDEST
+ * policy. Must be called with the interrupts disabled.
+ *
+ * @return true if an event has been discarded, false if the ring is empty, or if its oldest event is being moved into
+ * its queue or does not have the LLEVENT_OVERFLOW_DROP_OLDEST policy.
+ */
+static bool discard_oldest_spilled_event(void) {
+	LLEVENT_amp_event_t event;
+	bool discarded = !overflow_event_moving && LLEVENT_AMP_peek_event(&overflow_ring, &event) &&
+	                 ((uint8_t)LLEVENT_OVERFLOW_DROP_OLDEST == event_types[(uint32_t)event.type].overflow_policy);
+	if (discarded) {
+		LLEVENT_AMP_release_event(&overflow_ring, &event);
+		count_dropped_event((uint32_t)event.type);
+	}
+	return discarded;
+}
+
+/**
+ * Spills an event into the overflow ring and resumes the Java thread of its queue, which moves it into the queue
+ * before it checks the queues (see start_wait()), or records the event as dropped if the ring is full. An event of the
+ * LLEVENT_OVERFLOW_DROP_OLDEST policy takes the place of the oldest events of the ring if they have this policy too.
+ *
+ * @param type the type of the event.
+ * @param data the data of a simple event, the number of bytes of data of an extended event.
+ * @param extended_data the data of an extended event, NULL for a simple event.
+ * @param flags the OFFER_* flags of the offer, the failure of a retried offer is not recorded.
+ * @return true if the event has been spilled, false otherwise.
+ */
+static bool spill_event(uint32_t type, uint32_t data, const void* extended_data, uint32_t flags) {
+	bool from_isr = (flags & OFFER_FROM_ISR) != 0u;
+	const event_queue_t* queue = &event_queues[event_types[type].priority];
+	bool spilled = (NULL == extended_data) || fits_in_payload_buffer(queue, data);
+	if (spilled) {
+		UINT interrupt_state = tx_interrupt_control(TX_INT_DISABLE);
+		spilled = write_overflow_event(type, data, extended_data);
+		bool dropping = (uint8_t)LLEVENT_OVERFLOW_DROP_OLDEST == event_types[type].overflow_policy;
+		while (!spilled && dropping) {
+			dropping = discard_oldest_spilled_event();
+			spilled = dropping && write_overflow_event(type, data, extended_data);
+		}
+		(void)tx_interrupt_control(interrupt_state);
+	}
+
+	if (spilled) {
+		// The event is written before the waiting Java thread is checked, while the Java thread is set as waiting
+		// before it checks the ring (see start_wait()): one of them sees the other.
+		atomic_thread_fence(memory_order_seq_cst);
+		event_consumer_t* consumer = &event_consumers[queue->consumer];
+		resume_waiting_java_thread(consumer, take_waiting_java_thread_without_lock(consumer), from_isr);
+	} else if ((flags & OFFER_RETRIED) == 0u) {
+		if (!from_isr) {
+			LLEVENT_ERROR_TRACE("during spill_event ; the queue and the overflow ring are full \n");
+		}
+#if EVENT_INSTRUMENTATION == 1
+#if EVENT_LOCK_FREE_QUEUE == 1
+		LLEVENT_STATISTICS_record_offer(type, false);
+#else
+		UINT lock_state = event_queue_lock();
+		LLEVENT_STATISTICS_record_offer(type, false);
+		event_queue_unlock(lock_state);
+#endif // EVENT_LOCK_FREE_QUEUE == 1
+#endif // EVENT_INSTRUMENTATION == 1
+		count_dropped_event(type);
+	} else {
+		// The failure of a retried offer is recorded by its caller.
+	}
+	return spilled;
+}
+
+/**
+ * Offers an event to the queue with the overflow policy of its type: spilled into the overflow ring if its queue is
+ * full, or if the ring already holds events so that it does not overtake them.
+ *
+ * @param type the type of the event.
+ * @param data the data of the event.
+ * @param flags the OFFER_* flags of the offer.
+ * @return true if the message has been sent or spilled, false otherwise.
+ */
+static bool offer_event_with_policy(uint32_t type, uint32_t data, uint32_t flags) {
+	bool offer_status;
+	if ((uint8_t)LLEVENT_OVERFLOW_REJECT == event_types[type].overflow_policy) {
+		offer_status = offer_event(type, data, flags);
+	} else {
+		offer_status = is_overflow_ring_empty() && offer_event(type, data, flags | OFFER_RETRIED);
+		if (!offer_status) {
+			offer_status = spill_event(type, data, NULL, flags);
+		}
+	}
+	return offer_status;
+}
+
+/**
+ * Offers an extended event to the queue with the overflow policy of its type, see offer_event_with_policy(). The data
+ * of a spilled mapped extended event is copied into the overflow ring and given back to its producer at once.
+ *
+ * @param type the type of the event.
+ * @param data the data of the event.
+ * @param data_length the number of bytes of data.
+ * @param mapped_data the mapped data of the event, NULL to copy the data.
+ * @param flags the OFFER_* flags of the offer.
+ * @return true if the message has been sent or spilled, false otherwise.
+ */
+static bool offer_extended_event_with_policy(uint32_t type, const void* data, uint32_t data_length,
+                                             const mapped_data_t* mapped_data, uint32_t flags) {
+	bool offer_status;
+	if ((uint8_t)LLEVENT_OVERFLOW_REJECT == event_types[type].overflow_policy) {
+		offer_status = offer_extended_event(type, data, data_length, mapped_data, flags);
+	} else {
+		offer_status = is_overflow_ring_empty() &&
+		               offer_extended_event(type, data, data_length, mapped_data, flags | OFFER_RETRIED);
+		if (!offer_status) {
+			offer_status = spill_event(type, data_length, data, flags);
+			if (offer_status && (NULL != mapped_data) && (NULL != mapped_data->release)) {
+				mapped_data->release(data, mapped_data->release_arg);
+			}
+		}
+	}
+	return offer_status;
+}
+
+/**
+ * Discards the oldest event of a queue of a consumer to make room for a spilled event of the
+ * LLEVENT_OVERFLOW_DROP_OLDEST policy: the words of an extended event are released and its mapped data is given back
+ * to its producer.
+ *
+ * @param consumer the consumer of the queue, which is not reading an extended event.
+ * @param priority the priority of the queue.
+ * @return true if an event has been discarded, false if the queue is empty.
+ */
+static bool discard_oldest_event(event_consumer_t* consumer, uint32_t priority) {
+	uint32_t event_message;
+	bool discarded = TX_SUCCESS == receive_queue_event(consumer, priority, &event_message);
+	if (discarded) {
+		if (LLEVENT_FRAMING_is_extended(event_message)) {
+			start_read_extended_data(&consumer->reader, LLEVENT_FRAMING_get_data(event_message));
+			end_read_extended_data(&consumer->reader);
+		}
+		count_dropped_event(LLEVENT_FRAMING_get_type(event_message));
+	}
+	return discarded;
+}
+
+/**
+ * Moves the events of the overflow ring into their queues, in order, until the ring is empty or its first event does
+ * not fit in its queue. An event of the LLEVENT_OVERFLOW_DROP_OLDEST policy takes the place of the oldest events of its
+ * queue if the queue is dispatched by this consumer. At most the events of a full ring are moved.
+ *
+ * @param consumer the consumer of the calling Java thread.
+ */
+static void move_overflow_events(event_consumer_t* consumer) {
+	moved_overflow_write_index = atomic_load(&overflow_ring.write_index);
+
+	bool moved = true;
+	for (uint32_t i = 0; (i < RING_MAX_EVENTS) && moved; i++) {
+		LLEVENT_amp_event_t event;
+		// The head of the ring is read and released with the interrupts disabled, and not discarded by the producers
+		// while it is being moved (see discard_oldest_spilled_event()).
+		UINT interrupt_state = tx_interrupt_control(TX_INT_DISABLE);
+		moved = LLEVENT_AMP_peek_event(&overflow_ring, &event);
+		overflow_event_moving = moved;
+		(void)tx_interrupt_control(interrupt_state);
+		if (moved) {
+			const event_type_t* event_type = &event_types[(uint32_t)event.type];
+			bool dropping = ((uint8_t)LLEVENT_OVERFLOW_DROP_OLDEST == event_type->overflow_policy) &&
+			                (&event_consumers[event_queues[event_type->priority].consumer] == consumer);
+			moved = offer_ring_event(&event);
+			while (!moved && dropping) {
+				dropping = discard_oldest_event(consumer, (uint32_t)event_type->priority);
+				moved = dropping && offer_ring_event(&event);
+			}
+			interrupt_state = tx_interrupt_control(TX_INT_DISABLE);
+			if (moved) {
+				LLEVENT_AMP_release_event(&overflow_ring, &event);
+			}
+			overflow_event_moving = false;
+			(void)tx_interrupt_control(interrupt_state);
+		}
+	}
+}
+
+#else
+
+/**
+ * Offers an event to the queue, rejected if the queue is full.
+ */
+static bool offer_event_with_policy(uint32_t type, uint32_t data, uint32_t flags) {
+	return offer_event(type, data, flags);
+}
+
+/**
+ * Offers an extended event to the queue, rejected if the queue is full.
+ */
+static bool offer_extended_event_with_policy(uint32_t type, const void* data, uint32_t data_length,
+                                             const mapped_data_t* mapped_data, uint32_t flags) {
+	return offer_extended_event(type, data, data_length, mapped_data, flags);
+}
+
+#endif // EVENT_OVERFLOW_POLICY_SUPPORT == 1
+
+// -----------------------------------------------------------------------------
+// Public function definition
+// -----------------------------------------------------------------------------
+
+/**
+ * Starts the event pump.
+ */
+void LLEVENT_IMPL_initialize(void) {
+	LLEVENT_TRACE_initialize();
+	UINT queue_status = TX_SUCCESS;
+	// The words of the pools already given to the previous queues.
+	uint32_t queue_pool_used = 0;
+	uint32_t payload_pool_used = 0;
+	for (uint32_t i = 0; (i < (uint32_t)EVENT_QUEUE_COUNT) && (TX_SUCCESS == queue_status); i++) {
+		event_queue_t* queue = &event_queues[i];
+		uint32_t queue_size = (0u != event_queue_sizes[i]) ? event_queue_sizes[i] : (uint32_t)EVENT_QUEUE_SIZE;
+		uint32_t payload_words = ((0u != event_payload_buffer_sizes[i]) ? event_payload_buffer_sizes[i] :
+		                          (uint32_t)EVENT_PAYLOAD_BUFFER_SIZE) / (uint32_t)sizeof(uint32_t);
+		if (((queue_pool_used + queue_size) > (uint32_t)EVENT_QUEUE_POOL_SIZE) ||
+		    ((payload_pool_used + payload_words) > PAYLOAD_POOL_WORDS)) {
+			LLEVENT_ERROR_TRACE("during initialize ; the pools are too small for queue %u \n", (unsigned int)i);
+			queue_status = TX_SIZE_ERROR;
+		} else {
+#if EVENT_LOCK_FREE_QUEUE == 1
+			// The ring buffer takes one more word, always left empty.
+			uint32_t ring_index = queue_pool_used + payload_pool_used + i;
+			queue->payload_buffer = &event_ring_pool[ring_index];
+			queue->payload_buffer_words = queue_size + payload_words + 1u;
+#if OFFER_TIMESTAMPS == 1
+			queue->timestamps = &event_timestamp_pool[ring_index];
+#endif // OFFER_TIMESTAMPS == 1
+			// All the words of the ring buffer are empty.
+			(void)memset(&queue->payload_buffer[0], (int)0xFF,
+			             queue->payload_buffer_words * (uint32_t)sizeof(uint32_t));
+			atomic_init(&queue->payload_write_index, 0u);
+#else
+			queue->payload_buffer = &event_payload_pool[payload_pool_used];
+			queue->payload_buffer_words = payload_words;
+			// the size of messages is in 32-bit words, so 1 here, and the size of the queue is in bytes.
+			queue_status = tx_queue_create(&queue->queue, event_queue_name, 1, &event_queue_pool[queue_pool_used],
+			                               queue_size * (uint32_t)sizeof(uint32_t));
+			queue->payload_write_index = 0;
+#if OFFER_TIMESTAMPS == 1
+			queue->timestamps = &event_timestamp_pool[queue_pool_used + i];
+			queue->timestamp_count = queue_size + 1u;
+			queue->timestamp_write_index = 0;
+			queue->timestamp_read_index = 0;
+#endif // OFFER_TIMESTAMPS == 1
+#endif // EVENT_LOCK_FREE_QUEUE == 1
+			queue->payload_read_index = 0;
+			if (event_queue_consumers[i] < (uint8_t)EVENT_CONSUMER_COUNT) {
+				queue->consumer = event_queue_consumers[i];
+			} else {
+				LLEVENT_ERROR_TRACE("during initialize ; invalid consumer of queue %u, consumer 0 used \n", (unsigned int)i);
+				queue->consumer = 0;
+			}
+			queue_pool_used += queue_size;
+			payload_pool_used += payload_words;
+		}
+	}
+#if EVENT_ISR_SUPPORT == 1
+	UINT mutex_status = tx_semaphore_create(&wakeup_semaphore, wakeup_semaphore_name, 0);
+	if (TX_SUCCESS == mutex_status) {
+		mutex_status = tx_thread_create(&wakeup_thread, wakeup_thread_name, wakeup_thread_entry, 0,
+		                                &wakeup_thread_stack[0], sizeof(wakeup_thread_stack),
+		                                EVENT_WAKEUP_THREAD_PRIORITY, EVENT_WAKEUP_THREAD_PRIORITY, TX_NO_TIME_SLICE,
+		                                TX_AUTO_START);
+	}
+#elif EVENT_LOCK_FREE_QUEUE == 0
+	// A low priority producer holding the mutex inherits the priority of the producers waiting for it.
+	UINT mutex_status = tx_mutex_create(&mutex_send_event, mutex_queue_name, TX_INHERIT);
+#else
+	UINT mutex_status = TX_SUCCESS;
+#endif // EVENT_ISR_SUPPORT == 1
+#if EVENT_BLOCKING_OFFER_SUPPORT == 1
+	if (TX_SUCCESS == mutex_status) {
+		mutex_status = tx_semaphore_create(&space_semaphore, space_semaphore_name, 0);
+	}
+#endif // EVENT_BLOCKING_OFFER_SUPPORT == 1
+	for (uint32_t i = 0; i < (uint32_t)EVENT_CONSUMER_COUNT; i++) {
+		event_consumer_t* consumer = &event_consumers[i];
+#if EVENT_LOCK_FREE_QUEUE == 1
+		atomic_init(&consumer->waiting_receive_java_thread_id, SNI_ERROR);
+#else
+		consumer->waiting_receive_java_thread_id = SNI_ERROR;
+#endif // EVENT_LOCK_FREE_QUEUE == 1
+		consumer->reader_java_thread_id = SNI_ERROR;
+		consumer->timed_wait_suspended = false;
+#if EVENT_ISR_SUPPORT == 1
+		consumer->deferred_resume_java_thread_id = SNI_ERROR;
+#endif // EVENT_ISR_SUPPORT == 1
+#if EVENT_WAKEUP_BATCH_SIZE > 1
+#if EVENT_LOCK_FREE_QUEUE == 1
+		atomic_init(&consumer->wakeup_pending_events, 0u);
+#else
+		consumer->wakeup_pending_events = 0;
+#endif // EVENT_LOCK_FREE_QUEUE == 1
+		if (TX_SUCCESS == mutex_status) {
+			// The input of the timer is the index of its consumer.
+			mutex_status = tx_timer_create(&consumer->wakeup_timer, wakeup_timer_name, wakeup_timer_expiration, (ULONG)i,
+			                               (ULONG)EVENT_WAKEUP_DELAY, 0, TX_NO_ACTIVATE);
+		}
+#endif // EVENT_WAKEUP_BATCH_SIZE > 1
+	}
+	if ((TX_SUCCESS != queue_status) || (TX_SUCCESS != mutex_status)) {
+		if (SNI_throwNativeIOException(EVENT_NOK, "Not enough memory to allocate the queue.") == SNI_ERROR) {
+			LLEVENT_ERROR_TRACE("during EventQueue.getInstance(): Not enough memory to allocate the queue.\n");
+			LLEVENT_ERROR_TRACE(
+				"This function is not called within the virtual machine task or if the current thread is suspended.\n");
+			LLEVENT_ERROR_TRACE("queue_status = 0x%x ; mutex_status = 0x%x \n", queue_status, mutex_status);
+		}
+	}
+#if EVENT_COALESCING_SUPPORT == 1
+	for (uint32_t i = 0; i < (uint32_t)LLEVENT_FRAMING_MAX_TYPE_ID; i++) {
+#if EVENT_LOCK_FREE_QUEUE == 1
+		atomic_init(&coalesced_events[i], COALESCED_EVENT_NONE);
+#else
+		coalesced_events[i] = COALESCED_EVENT_NONE;
+#endif // EVENT_LOCK_FREE_QUEUE == 1
+	}
+#endif // EVENT_COALESCING_SUPPORT == 1
+
+	for (uint32_t i = 0; i < (uint32_t)EVENT_CONSUMER_COUNT; i++) {
+		event_reader_t* reader = &event_consumers[i].reader;
+		reader->data_length_extended_data = 0;
+		reader->offset_extended_data_read = 0;
+
+		reader->reading_queue = &event_queues[0];
+		reader->payload_event_read_index = 0;
+		reader->payload_event_end_index = 0;
+		reader->payload_event_release_index = 0;
+#if (EVENT_MAPPED_DATA_SUPPORT == 1) || (EVENT_DELTA_TYPE_COUNT > 0)
+		reader->reading_mapped_data.data = NULL;
+#endif // (EVENT_MAPPED_DATA_SUPPORT == 1) || (EVENT_DELTA_TYPE_COUNT > 0)
+
+		reader->buffer_extended_data = (uint32_t)NULL;
+		reader->offset_buffer_extended_data = -1;
+#if EVENT_READ_STAGING_BUFFER_SIZE > 0
+		reader->staged_words = 0;
+#endif // EVENT_READ_STAGING_BUFFER_SIZE > 0
+#if EVENT_TIMESTAMP_SUPPORT == 1
+		reader->event_timestamp = 0;
+#endif // EVENT_TIMESTAMP_SUPPORT == 1
+	}
+
+#if EVENT_DELTA_TYPE_COUNT > 0
+	for (uint32_t i = 0; i < (uint32_t)EVENT_DELTA_TYPE_COUNT; i++) {
+		delta_references[i].offered_length = DELTA_NO_REFERENCE;
+		delta_references[i].decoded_length = DELTA_NO_REFERENCE;
+	}
+#endif // EVENT_DELTA_TYPE_COUNT > 0
+}
+
+/**
+ * Offers an event to the queue.
+ *
+ * @param type the type of the event.
+ * @param data the data of the event.
+ * @return true if the message has been sent, false otherwise.
+ */
+bool LLEVENT_IMPL_offer_event(uint32_t type, uint32_t data) {
+	bool offer_status = true;
+	// The events of a disabled type are discarded before entering the critical section.
+	if (!is_event_filtered(type)) {
+		offer_status = offer_event_with_policy(type, data, 0);
+	}
+	return offer_status;
+}
+
+/**
+ * Offers an extended event to the queue.
+ *
+ * @param type the type of the event.
+ * @param data the data of the event.
+ * @return true if the message has been sent, false otherwise.
+ */
+bool LLEVENT_IMPL_offer_extended_event(uint32_t type, const void* data, uint32_t data_length) {
+	bool offer_status = true;
+	// The events of a disabled type are discarded before entering the critical section.
+	if (!is_event_filtered(type)) {
+		offer_status = offer_extended_event_with_policy(type, data, data_length, NULL, 0);
+	}
+	return offer_status;
+}
+
+#if EVENT_MAPPED_DATA_SUPPORT == 1
+
+/**
+ * Offers an extended event whose data stays in the buffer of the producer.
+ *
+ * @param type the type of the event.
+ * @param data the data of the event.
+ * @param data_length the number of bytes of data.
+ * @param release the function called once the data has been read, NULL if none.
+ * @param release_arg the argument given to release.
+ * @return true if the message has been sent, false otherwise.
+ */
+bool LLEVENT_IMPL_offer_mapped_extended_event(uint32_t type, const void* data, uint32_t data_length,
+                                              LLEVENT_release_callback_t release, void* release_arg) {
+	// cppcheck-suppress [misra-c2012-11.5]: conversion from void* to uint8_t* necessary to read the data in place.
+	mapped_data_t mapped_data = { (const uint8_t*)data, release, release_arg };
+	bool offer_status = true;
+	if (!is_event_filtered(type)) {
+		offer_status = offer_extended_event_with_policy(type, data, data_length, &mapped_data, 0);
+	} else if (NULL != release) {
+		// The event of a disabled type is discarded: give the data back at once.
+		release(data, release_arg);
+	} else {
+		// Discarded event without release function.
+	}
+	return offer_status;
+}
+
+#if EVENT_ISR_SUPPORT == 1
+
+/**
+ * Offers an extended event whose data stays in the buffer of the producer from an interrupt handler.
+ *
+ * @param type the type of the event.
+ * @param data the data of the event.
+ * @param data_length the number of bytes of data.
+ * @param release the function called once the data has been read, NULL if none.
+ * @param release_arg the argument given to release.
+ * @return true if the message has been sent, false otherwise.
+ */
+bool LLEVENT_IMPL_offer_mapped_extended_event_from_isr(uint32_t type, const void* data, uint32_t data_length,
+                                                       LLEVENT_release_callback_t release, void* release_arg) {
+	// cppcheck-suppress [misra-c2012-11.5]: conversion from void* to uint8_t* necessary to read the data in place.
+	mapped_data_t mapped_data = { (const uint8_t*)data, release, release_arg };
+	bool offer_status = true;
+	if (!is_event_filtered(type)) {
+		offer_status = offer_extended_event_with_policy(type, data, data_length, &mapped_data, OFFER_FROM_ISR);
+	} else if (NULL != release) {
+		// The event of a disabled type is discarded: give the data back at once.
+		release(data, release_arg);
+	} else {
+		// Discarded event without release function.
+	}
+	return offer_status;
+}
+
+#endif // EVENT_ISR_SUPPORT == 1
+
+#endif // EVENT_MAPPED_DATA_SUPPORT == 1
+
+#if EVENT_BLOCKING_OFFER_SUPPORT == 1
+
+/**
+ * Offers an event to the queue, waiting for space in the queue if it is full.
+ *
+ * @param type the type of the event.
+ * @param data the data of the event.
+ * @param timeout the max time to wait in ThreadX ticks, TX_NO_WAIT or TX_WAIT_FOREVER.
+ * @return true if the message has been sent, false otherwise.
+ */
+bool LLEVENT_IMPL_offer_event_with_timeout(uint32_t type, uint32_t data, uint32_t timeout) {
+	ULONG start_time = tx_time_get();
+	// The events of a disabled type are discarded before waiting for space.
+	bool offer_status = is_event_filtered(type);
+	if (!offer_status) {
+		offer_status = offer_event_with_policy(type, data, OFFER_RETRIED);
+		if (!offer_status && (TX_NO_WAIT != (ULONG)timeout)) {
+			// Retry once registered, then each time the Java thread frees space.
+			set_producer_blocked(true);
+			offer_status = offer_event_with_policy(type, data, OFFER_RETRIED);
+			while (!offer_status && wait_for_space(start_time, (ULONG)timeout)) {
+				offer_status = offer_event_with_policy(type, data, OFFER_RETRIED);
+			}
+			set_producer_blocked(false);
+			// The space may be enough for another blocked producer.
+			notify_space_available();
+		}
+		if (!offer_status) {
+			LLEVENT_ERROR_TRACE("during offer_event_with_timeout ; the queue is still full \n");
+#if EVENT_INSTRUMENTATION == 1
+#if EVENT_LOCK_FREE_QUEUE == 1
+			LLEVENT_STATISTICS_record_offer(type, false);
+#else
+			// The counters are updated within the critical section, like the other offers.
+			UINT lock_state = event_queue_lock();
+			LLEVENT_STATISTICS_record_offer(type, false);
+			event_queue_unlock(lock_state);
+#endif // EVENT_LOCK_FREE_QUEUE == 1
+#endif // EVENT_INSTRUMENTATION == 1
+#if EVENT_OVERFLOW_POLICY_SUPPORT == 1
+			count_dropped_event(type);
+#endif // EVENT_OVERFLOW_POLICY_SUPPORT == 1
+		}
+	}
+	return offer_status;
+}
+
+/**
+ * Offers an extended event to the queue, waiting for space in the queue if it is full.
+ *
+ * @param type the type of the event.
+ * @param data the data of the event.
+ * @param data_length the number of bytes of data.
+ * @param timeout the max time to wait in ThreadX ticks, TX_NO_WAIT or TX_WAIT_FOREVER.
+ * @return true if the message has been sent, false otherwise.
+ */
+bool LLEVENT_IMPL_offer_extended_event_with_timeout(uint32_t type, const void* data, uint32_t data_length,
+                                                    uint32_t timeout) {
+	ULONG start_time = tx_time_get();
+	// The events of a disabled type are discarded before waiting for space.
+	bool offer_status = is_event_filtered(type);
+	if (!offer_status) {
+		offer_status = offer_extended_event_with_policy(type, data, data_length, NULL, OFFER_RETRIED);
+		if (!offer_status && (TX_NO_WAIT != (ULONG)timeout)) {
+			// Retry once registered, then each time the Java thread frees space.
+			set_producer_blocked(true);
+			offer_status = offer_extended_event_with_policy(type, data, data_length, NULL, OFFER_RETRIED);
+			while (!offer_status && wait_for_space(start_time, (ULONG)timeout)) {
+				offer_status = offer_extended_event_with_policy(type, data, data_length, NULL, OFFER_RETRIED);
+			}
+			set_producer_blocked(false);
+			// The space may be enough for another blocked producer.
+			notify_space_available();
+		}
+		if (!offer_status) {
+			LLEVENT_ERROR_TRACE("during offer_extended_event_with_timeout ; the queue is still full \n");
+#if EVENT_INSTRUMENTATION == 1
+#if EVENT_LOCK_FREE_QUEUE == 1
+			LLEVENT_STATISTICS_record_offer(type, false);
+#else
+			// The counters are updated within the critical section, like the other offers.
+			UINT lock_state = event_queue_lock();
+			LLEVENT_STATISTICS_record_offer(type, false);
+			event_queue_unlock(lock_state);
+#endif // EVENT_LOCK_FREE_QUEUE == 1
+#endif // EVENT_INSTRUMENTATION == 1
+#if EVENT_OVERFLOW_POLICY_SUPPORT == 1
+			count_dropped_event(type);
+#endif // EVENT_OVERFLOW_POLICY_SUPPORT == 1
+		}
+	}
+	return offer_status;
+}
+
+#endif // EVENT_BLOCKING_OFFER_SUPPORT == 1
+
+#if EVENT_ISR_SUPPORT == 1
+
+/**
+ * Offers an event to the queue from an interrupt handler.
+ *
+ * @param type the type of the event.
+ * @param data the data of the event.
+ * @return true if the message has been sent, false otherwise.
+ */
+bool LLEVENT_IMPL_offer_event_from_isr(uint32_t type, uint32_t data) {
+	bool offer_status = true;
+	// The events of a disabled type are discarded before entering the critical section.
+	if (!is_event_filtered(type)) {
+		offer_status = offer_event_with_policy(type, data, OFFER_FROM_ISR);
+	}
+	return offer_status;
+}
+
+/**
+ * Offers an extended event to the queue from an interrupt handler.
+ *
+ * @param type the type of the event.
+ * @param data the data of the event.
+ * @return true if the message has been sent, false otherwise.
+ */
+bool LLEVENT_IMPL_offer_extended_event_from_isr(uint32_t type, const void* data, uint32_t data_length) {
+	bool offer_status = true;
+	// The events of a disabled type are discarded before entering the critical section.
+	if (!is_event_filtered(type)) {
+		offer_status = offer_extended_event_with_policy(type, data, data_length, NULL, OFFER_FROM_ISR);
+	}
+	return offer_status;
+}
+
+#endif // EVENT_ISR_SUPPORT == 1
+
+/**
+ * Sets the priority of an event type: the events of this type are sent to the queue of this priority.
+ *
+ * @param type the type of the event.
+ * @param priority the priority, between 0 (the lowest, default) and EVENT_QUEUE_COUNT - 1 (the highest).
+ */
+void LLEVENT_IMPL_set_type_priority(uint32_t type, uint32_t priority) {
+	event_types[type].priority = (uint8_t)priority;
+}
+
+/**
+ * Gets the priority of an event type.
+ *
+ * @param type the type of the event.
+ * @return the priority, between 0 (the lowest, default) and EVENT_QUEUE_COUNT - 1 (the highest).
+ */
+uint32_t LLEVENT_IMPL_get_type_priority(uint32_t type) {
+	return (uint32_t)event_types[type].priority;
+}
+
+#if EVENT_WAKEUP_BATCH_SIZE > 1
+
+/**
+ * Sets the urgency of an event type: an urgent event resumes the waiting Java thread at once.
+ *
+ * @param type the type of the event.
+ * @param urgent true for an urgent type, false for a deferrable type.
+ */
+void LLEVENT_IMPL_set_type_urgent(uint32_t type, bool urgent) {
+	event_types[type].urgent = urgent;
+}
+
+#endif // EVENT_WAKEUP_BATCH_SIZE > 1
+
+/**
+ * Offers a batch of events to the queue, all or none of them.
+ *
+ * @param events the events of the batch, all of the same priority.
+ * @param count the number of events, between 1 and LLEVENT_BATCH_MAX_EVENTS.
+ * @return true if the events have been sent, false otherwise.
+ */
+bool LLEVENT_IMPL_offer_events(const LLEVENT_batch_event_t* events, uint32_t count) {
+	return offer_events(events, count, 0);
+}
+
+#if EVENT_ISR_SUPPORT == 1
+
+/**
+ * Offers a batch of events to the queue from an interrupt handler, all or none of them.
+ *
+ * @param events the events of the batch, all of the same priority.
+ * @param count the number of events, between 1 and LLEVENT_BATCH_MAX_EVENTS.
+ * @return true if the events have been sent, false otherwise.
+ */
+bool LLEVENT_IMPL_offer_events_from_isr(const LLEVENT_batch_event_t* events, uint32_t count) {
+	return offer_events(events, count, OFFER_FROM_ISR);
+}
+
+#endif // EVENT_ISR_SUPPORT == 1
+
+#if EVENT_PRODUCER_LANE_COUNT > 0
+
+/**
+ * Resumes the Java thread waiting for the event written into a lane, without taking the mutex of the queues, or
+ * records the event as dropped if the lane is full.
+ *
+ * @param type the type of the event.
+ * @param event_sent true if the event has been written into the lane.
+ */
+static void notify_lane_event(uint32_t type, bool event_sent) {
+	if (event_sent) {
+		// The event is written before the waiting Java thread is checked, while the Java thread is set as waiting
+		// before it checks the lanes (see start_wait()): one of them sees the other.
+		atomic_thread_fence(memory_order_seq_cst);
+		event_consumer_t* consumer = &event_consumers[event_queues[event_types[type].priority].consumer];
+		resume_waiting_java_thread(consumer, take_waiting_java_thread_without_lock(consumer), false);
+	} else {
+#if EVENT_INSTRUMENTATION == 1
+#if EVENT_LOCK_FREE_QUEUE == 1
+		LLEVENT_STATISTICS_record_offer(type, false);
+#else
+		UINT lock_state = event_queue_lock();
+		LLEVENT_STATISTICS_record_offer(type, false);
+		event_queue_unlock(lock_state);
+#endif // EVENT_LOCK_FREE_QUEUE == 1
+#endif // EVENT_INSTRUMENTATION == 1
+#if EVENT_OVERFLOW_POLICY_SUPPORT == 1
+		count_dropped_event(type);
+#endif // EVENT_OVERFLOW_POLICY_SUPPORT == 1
+	}
+}
+
+/**
+ * Registers a producer lane.
+ *
+ * @return the index of the lane, -1 if all the lanes are registered.
+ */
+int32_t LLEVENT_IMPL_register_producer_lane(void) {
+	uint32_t lane = atomic_load(&registered_producer_lanes);
+	bool registered = false;
+	while (!registered && (lane < (uint32_t)EVENT_PRODUCER_LANE_COUNT)) {
+		// On failure, lane is updated with the lanes registered by another producer.
+		registered = atomic_compare_exchange_weak(&registered_producer_lanes, &lane, lane + 1u);
+	}
+	return registered ? (int32_t)lane : (int32_t)-1;
+}
+
+/**
+ * Offers an event to a producer lane.
+ *
+ * @param lane the index of the lane.
+ * @param type the type of the event.
+ * @param data the data of the event.
+ * @return true if the event has been written into the lane, false if the lane is full.
+ */
+bool LLEVENT_IMPL_offer_lane_event(uint32_t lane, uint32_t type, uint32_t data) {
+	bool event_sent = true;
+	// The events of a disabled type are discarded before they are written into the lane.
+	if (!is_event_filtered(type)) {
+		event_sent = LLEVENT_AMP_offer_event(&producer_lanes[lane], (int32_t)type, (int32_t)data);
+		notify_lane_event(type, event_sent);
+	}
+	return event_sent;
+}
+
+/**
+ * Offers an extended event to a producer lane.
+ *
+ * @param lane the index of the lane.
+ * @param type the type of the event.
+ * @param data the data of the event.
+ * @param data_length the number of bytes of data.
+ * @return true if the event has been written into the lane, false if the lane is full or if the data cannot fit in
+ * the payload buffer of its queue.
+ */
+bool LLEVENT_IMPL_offer_lane_extended_event(uint32_t lane, uint32_t type, const void* data, uint32_t data_length) {
+	bool event_sent = true;
+	// The events of a disabled type are discarded before they are written into the lane.
+	if (!is_event_filtered(type)) {
+		event_sent = fits_in_payload_buffer(&event_queues[event_types[type].priority], data_length) &&
+		             LLEVENT_AMP_offer_extended_event(&producer_lanes[lane], (int32_t)type, data, data_length);
+		notify_lane_event(type, event_sent);
+	}
+	return event_sent;
+}
+
+#endif // EVENT_PRODUCER_LANE_COUNT > 0
+
+#if EVENT_COALESCING_SUPPORT == 1
+
+/**
+ * Enables or disables the coalescing of the events of a type: when enabled, an event replaces the previous event of
+ * the same type still in the queue instead of taking a new place.
+ *
+ * @param type the type of the event.
+ * @param coalescing true to enable the coalescing, false to disable it.
+ */
+void LLEVENT_IMPL_set_type_coalescing(uint32_t type, bool coalescing) {
+	event_types[type].coalescing = coalescing;
+}
+
+/**
+ * Checks whether the events of a type are coalesced.
+ *
+ * @param type the type of the event.
+ * @return true if the simple events of the type are coalesced, false otherwise.
+ */
+bool LLEVENT_IMPL_is_type_coalescing(uint32_t type) {
+	return event_types[type].coalescing;
+}
+
+#endif // EVENT_COALESCING_SUPPORT == 1
+
+#if EVENT_TYPE_FILTER_SUPPORT == 1
+
+/**
+ * Enables or disables the events of a type: the events of a disabled type are discarded by the offers.
+ *
+ * @param type the type of the event.
+ * @param enabled true to enable the events of the type, false to discard them.
+ */
+void LLEVENT_IMPL_set_type_enabled(uint32_t type, bool enabled) {
+	uint32_t type_bit = (uint32_t)1u << (type % TYPES_PER_WORD);
+#if EVENT_LOCK_FREE_QUEUE == 1
+	if (enabled) {
+		(void)atomic_fetch_and(&disabled_types[type / TYPES_PER_WORD], ~type_bit);
+	} else {
+		(void)atomic_fetch_or(&disabled_types[type / TYPES_PER_WORD], type_bit);
+	}
+#else
+	// The producers only read the mask, the lock serializes the concurrent updates.
+	UINT lock_state = event_queue_lock();
+	if (enabled) {
+		disabled_types[type / TYPES_PER_WORD] &= ~type_bit;
+	} else {
+		disabled_types[type / TYPES_PER_WORD] |= type_bit;
+	}
+	event_queue_unlock(lock_state);
+#endif // EVENT_LOCK_FREE_QUEUE == 1
+}
+
+#endif // EVENT_TYPE_FILTER_SUPPORT == 1
+
+#if EVENT_OVERFLOW_POLICY_SUPPORT == 1
+
+/**
+ * Sets the policy applied to the events of a type offered while their queue is full.
+ *
+ * @param type the type of the event.
+ * @param policy one of the LLEVENT_OVERFLOW_* policies.
+ */
+void LLEVENT_IMPL_set_type_overflow_policy(uint32_t type, uint32_t policy) {
+	event_types[type].overflow_policy = (uint8_t)policy;
+}
+
+/**
+ * Gets the number of events of a type lost because their queue was full.
+ *
+ * @param type the type of the event.
+ * @return the number of events lost, 0 if the type is invalid.
+ */
+jint LLEVENT_IMPL_get_type_dropped_events(jint type) {
+	jint dropped_events = 0;
+	if ((type >= (jint)0) && (type < (jint)LLEVENT_FRAMING_MAX_TYPE_ID)) {
+#if EVENT_LOCK_FREE_QUEUE == 1
+		dropped_events = (jint)atomic_load_explicit(&dropped_type_events[type], memory_order_relaxed);
+#else
+		dropped_events = (jint)dropped_type_events[type];
+#endif // EVENT_LOCK_FREE_QUEUE == 1
+	}
+	return dropped_events;
+}
+
+#endif // EVENT_OVERFLOW_POLICY_SUPPORT == 1
+
+#if EVENT_DELTA_TYPE_COUNT > 0
+
+/**
+ * Enables or disables the delta encoding of the extended events of a type. The first extended event of the type
+ * offered once enabled is stored as is.
+ *
+ * @param type the type of the event.
+ * @param encoding true to delta-encode the extended events of the type, false to store them as is.
+ * @return true if done, false if the references of all the EVENT_DELTA_TYPE_COUNT types are already used.
+ */
+bool LLEVENT_IMPL_set_type_delta_encoding(uint32_t type, bool encoding) {
+	bool set = true;
+	UINT lock_state = event_queue_lock();
+	uint32_t reference_index = (uint32_t)event_types[type].delta_reference;
+	if ((0u == reference_index) && encoding) {
+		if (delta_reference_count < (uint32_t)EVENT_DELTA_TYPE_COUNT) {
+			delta_reference_count++;
+			reference_index = delta_reference_count;
+			event_types[type].delta_reference = (uint8_t)reference_index;
+		} else {
+			set = false;
+		}
+	}
+	if (0u != reference_index) {
+		delta_reference_t* reference = &delta_references[reference_index - 1u];
+		reference->encoding = encoding;
+		reference->offered_length = DELTA_NO_REFERENCE;
+	}
+	event_queue_unlock(lock_state);
+	return set;
+}
+
+#endif // EVENT_DELTA_TYPE_COUNT > 0
+
+#if EVENT_PRODUCER_LANE_COUNT > 0
+
+/**
+ * Moves the first event of a producer lane into its queue.
+ *
+ * @return true if an event has been moved, false if the lane is empty or if its first event does not fit in its queue.
+ */
+static bool move_lane_event(LLEVENT_amp_ring_t* lane) {
+	LLEVENT_amp_event_t event;
+	bool moved = LLEVENT_AMP_peek_event(lane, &event);
+	if (moved) {
+		// The event stays in the lane until space is available in its queue.
+		moved = offer_ring_event(&event);
+		if (moved) {
+			LLEVENT_AMP_release_event(lane, &event);
+		}
+	}
+	return moved;
+}
+
+/**
+ * Moves the events of the producer lanes into their queues, one event of each lane in turn and starting from another
+ * lane each time, so that the lanes share the space of the queues. At most the events of a full lane are moved from
+ * each lane.
+ */
+static void move_lane_events(void) {
+	uint32_t lane_count = atomic_load(&registered_producer_lanes);
+	for (uint32_t i = 0; i < lane_count; i++) {
+		moved_lane_write_indexes[i] = atomic_load(&producer_lanes[i].write_index);
+	}
+
+	bool moved = lane_count > 0u;
+	for (uint32_t event = 0; (event < RING_MAX_EVENTS) && moved; event++) {
+		moved = false;
+		for (uint32_t i = 0; i < lane_count; i++) {
+			// Not short-circuited: every lane moves an event.
+			bool lane_moved = move_lane_event(&producer_lanes[(first_moved_lane + i) % lane_count]);
+			moved = moved || lane_moved;
+		}
+	}
+
+	if (lane_count > 0u) {
+		first_moved_lane = (first_moved_lane + 1u) % lane_count;
+	}
+}
+
+/**
+ * Checks whether events have been written into the producer lanes since their events were last moved.
+ */
+static bool are_lanes_written(void) {
+	uint32_t lane_count = atomic_load(&registered_producer_lanes);
+	bool written = false;
+	for (uint32_t i = 0; (i < lane_count) && !written; i++) {
+		written = atomic_load(&producer_lanes[i].write_index) != moved_lane_write_indexes[i];
+	}
+	return written;
+}
+
+#endif // EVENT_PRODUCER_LANE_COUNT > 0
+
+/**
+ * Starts a wait of the current Java thread for the events of a consumer, before it checks the queues: moves the events
+ * of the overflow ring and of the producer lanes into the queues and registers the Java thread as waiting (see
+ * set_waiting_java_thread()).
+ */
+static void start_wait(event_consumer_t* consumer) {
+#if (EVENT_PRODUCER_LANE_COUNT > 0) || (EVENT_OVERFLOW_POLICY_SUPPORT == 1)
+	bool events_written = true;
+	while (events_written) {
+		// Not waiting while the events are moved, so that the Java thread does not resume itself.
+		int32_t java_thread_id = take_waiting_java_thread_without_lock(consumer);
+		(void)java_thread_id;
+#if EVENT_OVERFLOW_POLICY_SUPPORT == 1
+		move_overflow_events(consumer);
+#endif // EVENT_OVERFLOW_POLICY_SUPPORT == 1
+#if EVENT_PRODUCER_LANE_COUNT > 0
+		move_lane_events();
+#endif // EVENT_PRODUCER_LANE_COUNT > 0
+		set_waiting_java_thread(consumer);
+		// The events written into a lane or spilled in the meantime have not resumed the Java thread.
+		atomic_thread_fence(memory_order_seq_cst);
+		events_written = false;
+#if EVENT_OVERFLOW_POLICY_SUPPORT == 1
+		events_written = atomic_load(&overflow_ring.write_index) != moved_overflow_write_index;
+#endif // EVENT_OVERFLOW_POLICY_SUPPORT == 1
+#if EVENT_PRODUCER_LANE_COUNT > 0
+		events_written = events_written || are_lanes_written();
+#endif // EVENT_PRODUCER_LANE_COUNT > 0
+	}
+#else
+	set_waiting_java_thread(consumer);
+#endif // (EVENT_PRODUCER_LANE_COUNT > 0) || (EVENT_OVERFLOW_POLICY_SUPPORT == 1)
+}
+
+/**
+ * Waits for an event from the queues of a consumer.
+ *
+ * @param consumer the consumer.
+ * @param callback the native called again once the Java thread is resumed.
+ * @return the event.
+ */
+static uint32_t wait_event(event_consumer_t* consumer, SNI_callback callback) {
+	// Get the thread Id in case the thread is suspended.
+	start_wait(consumer);
+
+	uint32_t event_message;
+
+	// Fetch a message from the queues. Suspend the thread if no message available.
+	UINT status = receive_event(consumer, &event_message);
+	if (TX_SUCCESS != status) {
+		LLEVENT_TRACE_RECORD(LLEVENT_TRACE_EVENT_SUSPEND, consumer->reader_java_thread_id,
+		                     (uint32_t)(consumer - &event_consumers[0]));
+		if (SNI_suspendCurrentJavaThreadWithCallback(0, callback, NULL) == SNI_ERROR) {
+			// This function is not called within the virtual machine task or an exception is pending.
+			LLEVENT_ERROR_TRACE("while trying to suspend EventQueue thread.");
 			LLEVENT_ERROR_TRACE(
-				"while trying to resume the EventQueue waiting thread: The Java Thread ID is invalid, can't resume the Event Queue waiting thread.\n");
-			waiting_receive_java_thread_id = SNI_ERROR;
+				"The Event Queue is not called within the virtual machine task or an exception is pending.\n");
+			LLEVENT_ERROR_TRACE("An event has been returned with id 0 and data 0.\n");
+			consumer->waiting_receive_java_thread_id = SNI_ERROR;
+			// Set the returned event to 0.
+			event_message = 0;
+		}
+	} else {
+		consumer->waiting_receive_java_thread_id = SNI_ERROR;
+	}
+
+	return event_message;
+}
+
+/**
+ * Waits for events from the queues of a consumer and copies them into an array.
+ *
+ * With a timeout, the wait function called again once the Java thread is resumed returns without suspending it again
+ * if there is still no event: the Java thread has been resumed by the timeout.
+ *
+ * @param consumer the consumer.
+ * @param events the Java int array to fill with the events.
+ * @param timestamps the Java int array to fill with the offer times of the events, NULL if none.
+ * @param timeout the max time to wait in milliseconds, 0 to wait forever, negative to not wait.
+ * @param callback the native called again once the Java thread is resumed.
+ * @return the number of events copied into the array, 0 if the thread could not be suspended or if the timeout expired.
+ */
+static jint wait_events(event_consumer_t* consumer, jint* events, jint* timestamps, int64_t timeout,
+                        SNI_callback callback) {
+	// True if this call follows the resume of a wait with a timeout.
+	bool timed_wait_resumed = consumer->timed_wait_suspended;
+	consumer->timed_wait_suspended = false;
+
+	// Get the thread Id in case the thread is suspended.
+	start_wait(consumer);
+
+	// cppcheck-suppress [misra-c2012-11.3] : From sni.h with SNI_getArrayLength, cast used by many C framework to
+	// factorize code.
+	// cppcheck-suppress [misra-c2012-18.4] : From sni.h with SNI_getArrayLength, used for configurable C library.
+	uint32_t length = (uint32_t)SNI_getArrayLength(events);
+	uint32_t count = 0;
+	bool extended_event = false;
+#if EVENT_TIMESTAMP_SUPPORT == 1
+	if (NULL != timestamps) {
+		// cppcheck-suppress [misra-c2012-11.3] : From sni.h with SNI_getArrayLength, cast used by many C framework to
+		// factorize code.
+		// cppcheck-suppress [misra-c2012-18.4] : From sni.h with SNI_getArrayLength, used for configurable C library.
+		uint32_t timestamps_length = (uint32_t)SNI_getArrayLength(timestamps);
+		length = (timestamps_length < length) ? timestamps_length : length;
+	}
+#else
+	(void)timestamps;
+#endif // EVENT_TIMESTAMP_SUPPORT == 1
+
+	// Fetch the messages from the queues until the array is full or an extended event is fetched.
+	while ((count < length) && !extended_event) {
+		uint32_t event_message;
+		if (TX_SUCCESS != receive_event(consumer, &event_message)) {
+			break;
+		}
+		events[count] = (jint)event_message;
+#if EVENT_TIMESTAMP_SUPPORT == 1
+		if (NULL != timestamps) {
+			timestamps[count] = (jint)consumer->reader.event_timestamp;
+		}
+#endif // EVENT_TIMESTAMP_SUPPORT == 1
+		count++;
+		extended_event = LLEVENT_FRAMING_is_extended(event_message);
+	}
+
+	if ((0u == count) && (timed_wait_resumed || (timeout < 0))) {
+		// The timeout expired: the Java thread is no longer waiting.
+		consumer->waiting_receive_java_thread_id = SNI_ERROR;
+	} else if (0u == count) {
+		// Suspend the thread if no message available.
+		LLEVENT_TRACE_RECORD(LLEVENT_TRACE_EVENT_SUSPEND, consumer->reader_java_thread_id,
+		                     (uint32_t)(consumer - &event_consumers[0]));
+		if ((0u != length) && (SNI_suspendCurrentJavaThreadWithCallback(timeout, callback, NULL) == SNI_ERROR)) {
+			// This function is not called within the virtual machine task or an exception is pending.
+			LLEVENT_ERROR_TRACE("while trying to suspend EventQueue thread.");
+			LLEVENT_ERROR_TRACE(
+				"The Event Queue is not called within the virtual machine task or an exception is pending.\n");
+			consumer->waiting_receive_java_thread_id = SNI_ERROR;
 		} else {
-			waiting_receive_java_thread_id = SNI_ERROR;
+			consumer->timed_wait_suspended = (0 != timeout) && (0u != length);
 		}
+	} else {
+		consumer->waiting_receive_java_thread_id = SNI_ERROR;
+	}
+
+	return (jint)count;
+}
+
+/**
+ * Waits for an event from the queue.
+ *
+ * If an event is available, this function return the event. The events of the queues with a higher priority are
+ * returned first.
+ *
+ * @return the event
+ */
+uint32_t LLEVENT_IMPL_wait_event(void) {
+	return wait_event(&event_consumers[0], (SNI_callback)LLEVENT_IMPL_wait_event);
+}
+
+/**
+ * Waits for events from the queue and copies them into an array.
+ *
+ * If no event is available, the Java thread is suspended until an event is offered. Otherwise, the available events
+ * are copied into the array, up to its length, in the order LLEVENT_IMPL_wait_event() would return them. An extended
+ * event is always the last event copied: its data must be read before the next call.
+ *
+ * @param events the Java int array to fill with the events.
+ * @return the number of events copied into the array, 0 if the thread could not be suspended.
+ */
+jint LLEVENT_IMPL_wait_events(jint* events) {
+	return wait_events(&event_consumers[0], events, NULL, 0, (SNI_callback)LLEVENT_IMPL_wait_events);
+}
+
+/**
+ * Waits for events from the queue until a timeout and copies them into an array.
+ *
+ * @param events the Java int array to fill with the events.
+ * @param timeout the max time to wait in milliseconds, 0 to wait forever, negative to not wait.
+ * @return the number of events copied into the array, 0 if the timeout expired or if the thread could not be
+ * suspended.
+ */
+jint LLEVENT_IMPL_wait_events_with_timeout(jint* events, jlong timeout) {
+	return wait_events(&event_consumers[0], events, NULL, (int64_t)timeout,
+	                   (SNI_callback)LLEVENT_IMPL_wait_events_with_timeout);
+}
+
+#if EVENT_TIMESTAMP_SUPPORT == 1
+
+/**
+ * Waits for events from the queue and copies them and their offer times into two arrays.
+ *
+ * @param events the Java int array to fill with the events.
+ * @param timestamps the Java int array to fill with the offer times of the events.
+ * @return the number of events copied into the arrays, 0 if the thread could not be suspended.
+ */
+jint LLEVENT_IMPL_wait_timestamped_events(jint* events, jint* timestamps) {
+	return wait_events(&event_consumers[0], events, timestamps, 0,
+	                   (SNI_callback)LLEVENT_IMPL_wait_timestamped_events);
+}
+
+/**
+ * Gets the offer time of the event returned last to the calling Java thread.
+ *
+ * @return the EVENT_TIMESTAMP() value captured when the event was offered.
+ */
+jint LLEVENT_IMPL_get_event_timestamp(void) {
+	return (jint)get_reader()->event_timestamp;
+}
+
+/**
+ * Gets the current time, in the time base of the offer times of the events.
+ *
+ * @return the EVENT_TIMESTAMP() value.
+ */
+jint LLEVENT_IMPL_get_current_timestamp(void) {
+	return (jint)EVENT_TIMESTAMP();
+}
+
+#endif // EVENT_TIMESTAMP_SUPPORT == 1
+
+#if EVENT_CONSUMER_COUNT > 1
+
+/**
+ * Gets a consumer from its index, throws a NativeIOException if the index is invalid.
+ *
+ * @return the consumer, NULL if the index is invalid.
+ */
+static event_consumer_t* get_consumer(jint consumer) {
+	event_consumer_t* result = NULL;
+	if ((consumer >= (jint)0) && (consumer < (jint)EVENT_CONSUMER_COUNT)) {
+		result = &event_consumers[consumer];
+	} else {
+		(void)SNI_throwNativeIOException(EVENT_NOK, "Invalid event consumer.");
+	}
+	return result;
+}
+
+/**
+ * Waits for an event from the queues of a consumer.
+ *
+ * @param consumer the index of the consumer.
+ * @return the event, 0 if the consumer is invalid.
+ */
+jint LLEVENT_IMPL_wait_consumer_event(jint consumer) {
+	event_consumer_t* event_consumer = get_consumer(consumer);
+	uint32_t event_message = 0;
+	if (NULL != event_consumer) {
+		event_message = wait_event(event_consumer, (SNI_callback)LLEVENT_IMPL_wait_consumer_event);
 	}
+	return (jint)event_message;
+}
 
-	// Free the mutex after sending the extended event.
-	status = tx_mutex_put(&mutex_send_event);
-	if (TX_SUCCESS != status) {
-		LLEVENT_ERROR_TRACE("during attempt to release the mutex ; status = 0x%x \n", status);
+/**
+ * Waits for events from the queues of a consumer and copies them into an array.
+ *
+ * @param consumer the index of the consumer.
+ * @param events the Java int array to fill with the events.
+ * @return the number of events copied into the array, 0 if the consumer is invalid or if the thread could not be
+ * suspended.
+ */
+jint LLEVENT_IMPL_wait_consumer_events(jint consumer, jint* events) {
+	event_consumer_t* event_consumer = get_consumer(consumer);
+	jint count = 0;
+	if (NULL != event_consumer) {
+		count = wait_events(event_consumer, events, NULL, 0, (SNI_callback)LLEVENT_IMPL_wait_consumer_events);
 	}
-
-	return offer_status;
+	return count;
 }
 
 /**
- * Waits for an event from the queue.
+ * Waits for events from the queues of a consumer until a timeout and copies them into an array.
  *
- * If an event is available, this function return the event.
- *
- * @return the event
+ * @param consumer the index of the consumer.
+ * @param events the Java int array to fill with the events.
+ * @param timeout the max time to wait in milliseconds, 0 to wait forever, negative to not wait.
+ * @return the number of events copied into the array, 0 if the timeout expired, if the consumer is invalid or if the
+ * thread could not be suspended.
  */
-uint32_t LLEVENT_IMPL_wait_event(void) {
-	// Get the thread Id in case the thread is suspended.
-	waiting_receive_java_thread_id = SNI_getCurrentJavaThreadID();
-
-	uint32_t event_message;
-
-	// Fetch a message from the queue. Suspend the thread if no message available.
-	UINT status = tx_queue_receive(&event_queue, &event_message, TX_NO_WAIT);
-	if (TX_SUCCESS != status) {
-		if (SNI_suspendCurrentJavaThreadWithCallback(0, (SNI_callback)LLEVENT_IMPL_wait_event, NULL) == SNI_ERROR) {
-			// This function is not called within the virtual machine task or an exception is pending.
-			LLEVENT_ERROR_TRACE("while trying to suspend EventQueue thread.");
-			LLEVENT_ERROR_TRACE(
-				"The Event Queue is not called within the virtual machine task or an exception is pending.\n");
-			LLEVENT_ERROR_TRACE("An event has been returned with id 0 and data 0.\n");
-			waiting_receive_java_thread_id = SNI_ERROR;
-			// Set the returned event to 0.
-			event_message = 0;
-		}
-	} else {
-		waiting_receive_java_thread_id = SNI_ERROR;
+jint LLEVENT_IMPL_wait_consumer_events_with_timeout(jint consumer, jint* events, jlong timeout) {
+	event_consumer_t* event_consumer = get_consumer(consumer);
+	jint count = 0;
+	if (NULL != event_consumer) {
+		count = wait_events(event_consumer, events, NULL, (int64_t)timeout,
+		                    (SNI_callback)LLEVENT_IMPL_wait_consumer_events_with_timeout);
 	}
-
-	return event_message;
+	return count;
 }
 
+#endif // EVENT_CONSUMER_COUNT > 1
+
 /**
  * Starts to read an extended data. Set the data_length_extended_data to the data_length and reset the
  * offset_extended_data_read.
  * At this point, the data is 8 bytes aligned.
  */
 void LLEVENT_IMPL_start_read_extended_data(uint32_t data_length) {
-	data_length_extended_data = data_length;
-	offset_extended_data_read = 0;
-
-	data_alignment = 1;
+	event_reader_t* reader = get_reader();
+	start_read_extended_data(reader, data_length);
+#if EVENT_READ_STAGING_BUFFER_SIZE > 0
+	// Copy the data at once if it fits in the staging buffer (none if the data is not available).
+	reader->staged_words = stage_extended_data(reader, reader->data_length_extended_data);
+#endif // EVENT_READ_STAGING_BUFFER_SIZE > 0
 }
 
 /**
  * The Java listener finished to read the data from the event queue.
- * If there is any left data left in the queue, purge it.
+ * If there is any left data left in the queue, purge it in constant time.
  */
 void LLEVENT_IMPL_end_read_extended_data(void) {
-	// If there is still extended data inside event_queue, purge it.
-	if (LLEVENT_IMPL_skip_bytes(data_length_extended_data - offset_extended_data_read) == -1) {
-		LLEVENT_ERROR_TRACE("The Java listener did not finished properly. The message queue may not be purged.");
-	}
-
-	// reset the data length and the offset.
-	data_length_extended_data = 0;
-	offset_extended_data_read = 0;
-	// reset the buffer used to read bytes of an extended event.
-	buffer_extended_data = (uint32_t)NULL;
-	offset_buffer_extended_data = -1;
+	end_read_extended_data(get_reader());
 }
 
 /**
@@ -385,10 +4061,11 @@ jfloat LLEVENT_IMPL_read_float(void) {
  * Throws IOException if there are not enough bytes available or if the buffer is too small.
  */
 jint LLEVENT_IMPL_read(uint8_t* b, uint32_t off, uint32_t len) {
+	event_reader_t* reader = get_reader();
 	// Status of the method.
 	jboolean read_status = JTRUE;
 
-	uint32_t remaining_bytes = LLEVENT_IMPL_available();
+	uint32_t remaining_bytes = get_available_bytes(reader);
 	jint byte_read = 0;
 
 	// If not enough bytes available, throw a native IOException.
@@ -415,16 +4092,33 @@ jint LLEVENT_IMPL_read(uint8_t* b, uint32_t off, uint32_t len) {
 	}
 
 	// Read the len bytes from the event queue and store them in the buffer at the offset off.
+#if EVENT_READ_STAGING_BUFFER_SIZE > 0
+	if ((read_status == (jboolean)JTRUE) && (0u != reader->staged_words)) {
+		// Copy the bytes straight from the staging buffer.
+		(void)memcpy(&b[off], &((uint8_t*)reader->staging_buffer)[reader->offset_extended_data_read], len);
+		reader->offset_extended_data_read += len;
+		byte_read = (jint)len;
+	} else
+#endif // EVENT_READ_STAGING_BUFFER_SIZE > 0
 	if (read_status == (jboolean)JTRUE) {
-		for (uint32_t i = 0; i < len; i++) {
-			jbyte read_byte = read_one_byte();
+		uint32_t i = 0;
+		// Read byte per byte until the 4 bytes buffer is empty, then the whole words at once, then the last bytes.
+		while ((i < len) && (reader->offset_buffer_extended_data != (int8_t)-1) && (reader->offset_buffer_extended_data < (int8_t)4)) {
+			b[off + i] = reader_read_byte(reader);
+			i++;
+		}
+		uint32_t words = payload_read_words(reader, &b[off + i], (len - i) / (uint32_t)sizeof(uint32_t));
+		extended_data_words_read(reader, words);
+		i += words * (uint32_t)sizeof(uint32_t);
+		for (; i < len; i++) {
+			jbyte read_byte = reader_read_byte(reader);
 			// If an SNI exception occurs during reading, stop reading and return.
 			if (SNI_isExceptionPending()) {
 				break;
 			}
 			b[off + i] = read_byte;
-			byte_read++;
 		}
+		byte_read = (jint)i;
 	}
 
 	return byte_read;
@@ -475,23 +4169,43 @@ jchar LLEVENT_IMPL_read_unsigned_short(void) {
  * Returns -1 if it did not work.
  */
 jint LLEVENT_IMPL_skip_bytes(uint32_t n) {
+	event_reader_t* reader = get_reader();
 	// Status of the method.
 	jint skip_status = EVENT_OK;
 
 	// Number of byte skipped.
-	skip_bytes_counter = 0;
+	uint32_t skipped_bytes = 0;
 
 	// If less than n bytes available, return -1.
-	if (LLEVENT_IMPL_available() < n) {
+	if (get_available_bytes(reader) < n) {
 		skip_status = EVENT_NOK;
 	}
 
-	// Read n bytes from the event queue.
+	// Skip n bytes from the event queue.
+#if EVENT_READ_STAGING_BUFFER_SIZE > 0
+	if ((skip_status != EVENT_NOK) && (0u != reader->staged_words)) {
+		reader->offset_extended_data_read += n;
+		skipped_bytes = n;
+	} else
+#endif // EVENT_READ_STAGING_BUFFER_SIZE > 0
 	if (skip_status != EVENT_NOK) {
-		while (skip_bytes_counter < n) {
+		// Skip the bytes remaining in the 4 bytes buffer.
+		while ((skipped_bytes < n) && (reader->offset_buffer_extended_data != (int8_t)-1) &&
+		       (reader->offset_buffer_extended_data < (int8_t)4)) {
+			reader->offset_buffer_extended_data++;
+			reader->offset_extended_data_read++;
+			skipped_bytes++;
+		}
+		// Skip the whole words at once.
+		uint32_t words = payload_skip_words(reader, (n - skipped_bytes) / (uint32_t)sizeof(uint32_t));
+		extended_data_words_read(reader, words);
+		skipped_bytes += words * (uint32_t)sizeof(uint32_t);
+		// Skip the last bytes.
+		while (skipped_bytes < n) {
 			// Unused variable skipped_byte because the value returned by a function having non-void return value
 			// shall be used according to rule misra-c2012-17.7.
-			jbyte skipped_byte = read_one_byte();
+			jbyte skipped_byte = reader_read_byte(reader);
+			(void)skipped_byte;
 			// If an SNI exception occurs during reading, stop skipping and return -1.
 			if (SNI_isExceptionPending()) {
 				if (SNI_clearPendingException() == SNI_ERROR) {
@@ -501,7 +4215,7 @@ jint LLEVENT_IMPL_skip_bytes(uint32_t n) {
 				skip_status = EVENT_NOK;
 				break;
 			}
-			skip_bytes_counter++;
+			skipped_bytes++;
 		}
 	}
 
@@ -513,304 +4227,27 @@ jint LLEVENT_IMPL_skip_bytes(uint32_t n) {
  * Returns the number of available data bytes.
  */
 uint32_t LLEVENT_IMPL_available(void) {
-	return data_length_extended_data - offset_extended_data_read;
+	return get_available_bytes(get_reader());
 }
 
 // cppcheck-suppress [misra-c2012-8.4]: false positive, function prototype defined in event_configuration.h
 jbyte read_one_byte(void) {
-	jbyte read_byte = JTRUE;
-	// If less than one byte available, throw a native IOException.
-	if (LLEVENT_IMPL_available() < sizeof(jbyte)) {
-		if (SNI_throwNativeIOException(EVENT_NOK, "No byte remaining in the extended data.") == SNI_ERROR) {
-			LLEVENT_ERROR_TRACE("during EventDataReader reading: No byte remaining in the extended data.\n");
-			LLEVENT_ERROR_TRACE(
-				"This function is not called within the virtual machine task or if the current thread is suspended.\n");
-		}
-		read_byte = JFALSE;
-	}
-
-	if (read_byte == JTRUE) {
-		struct int_to_byte_t {
-			jbyte first_byte;
-			jbyte second_byte;
-			jbyte third_byte;
-			jbyte fourth_byte;
-		};
-
-		// If the static buffer is empty (offset == -1) or has been fully read (offset >= 4), read the next uint32_t of
-		// data from the event_queue.
-		if ((offset_buffer_extended_data == (int8_t)-1) || (offset_buffer_extended_data >= (int8_t)4)) {
-			// Fetch a message from the queue and store it in the static buffer. Suspend the thread if no message
-			// available.
-			UINT status = tx_queue_receive(&event_queue, &buffer_extended_data, TX_NO_WAIT);
-			if (TX_SUCCESS != status) {
-				if (SNI_throwNativeIOException(EVENT_NOK, "No more data on the message queue.") == SNI_ERROR) {
-					LLEVENT_ERROR_TRACE("during EventDataReader reading: No more data on the message queue.\n");
-					LLEVENT_ERROR_TRACE(
-						"This function is not called within the virtual machine task or if the current thread is suspended.\n");
-				}
-				read_byte = JFALSE;
-			} else {
-				// Set the offset of the buffer to 0 -> 0 byte has been read.
-				offset_buffer_extended_data = 0;
-				// Switch the alignment
-				data_alignment = data_alignment == (uint8_t)0 ? 1 : 0;
-			}
-		}
-
-		// Process the data if there is no error during SNI_suspendCurrentJavaThreadWithCallback
-		if (read_byte == JTRUE) {
-			// Get the next byte of data from the static buffer.
-			// IAR does not allow direct conversion from uint32_t* into int_to_byte_t*, intermediate data required.
-			struct int_to_byte_t int_to_byte_data;
-			struct int_to_byte_t* int_to_byte_ptr = &int_to_byte_data;
-			int_to_byte_ptr->first_byte = (buffer_extended_data & BYTE_ONE_MASK);
-			int_to_byte_ptr->second_byte = (((buffer_extended_data & BYTE_TWO_MASK) >> BYTE_TWO_SHIFT));
-			int_to_byte_ptr->third_byte = (((buffer_extended_data & BYTE_THREE_MASK) >> BYTE_THREE_SHIFT));
-			int_to_byte_ptr->fourth_byte = (((buffer_extended_data & BYTE_FOUR_MASK) >> BYTE_FOUR_SHIFT));
-
-			if (offset_buffer_extended_data == (int8_t)0) {
-				read_byte = int_to_byte_ptr->first_byte;
-			} else if (offset_buffer_extended_data == (int8_t)1) {
-				read_byte = int_to_byte_ptr->second_byte;
-			} else if (offset_buffer_extended_data == (int8_t)2) {
-				read_byte = int_to_byte_ptr->third_byte;
-			} else {
-				read_byte = int_to_byte_ptr->fourth_byte;
-			}
-			// Increment the offset of the static buffer.
-			offset_buffer_extended_data++;
-			// Increment the offset of the data read.
-			offset_extended_data_read++;
-		}
-	}
-
-	return read_byte;
+	return reader_read_byte(get_reader());
 }
 
 // cppcheck-suppress [misra-c2012-8.4]: false positive, function prototype defined in event_configuration.h
 jshort read_two_bytes(void) {
-	jshort event_short = JTRUE;
-	// If less than 2 bytes available, throw a native IOException.
-	if (LLEVENT_IMPL_available() < sizeof(jshort)) {
-		if (SNI_throwNativeIOException(EVENT_NOK, "Less than two bytes remaining in the extended data.") == SNI_ERROR) {
-			LLEVENT_ERROR_TRACE(
-				"during EventDataReader reading: Less than two bytes remaining in the extended data.\n");
-			LLEVENT_ERROR_TRACE(
-				"This function is not called within the virtual machine task or if the current thread is suspended.\n");
-		}
-		event_short = JFALSE;
-	}
-
-	if (event_short == JTRUE) {
-		struct int_to_short_t {
-			jshort first_short;
-			jshort second_short;
-		};
-
-		// If the static buffer is empty (offset == -1) or has no char remaining (offset >= 3), read the next uint32_t
-		// of data from the event_queue.
-		if ((offset_buffer_extended_data == (int8_t)-1) || (offset_buffer_extended_data >= (int8_t)3)) {
-			// If offset equals 3, an alignment is done -> increase the offset_extended_data_read.
-			if (offset_buffer_extended_data == (int8_t)3) {
-				offset_extended_data_read++;
-			}
-
-			// Fetch a message from the queue and store it in the static buffer. Suspend the thread if no message
-			// available.
-			UINT status = tx_queue_receive(&event_queue, &buffer_extended_data, TX_NO_WAIT);
-			if (TX_SUCCESS != status) {
-				if (SNI_throwNativeIOException(EVENT_NOK, "No more data on the message queue.") == SNI_ERROR) {
-					LLEVENT_ERROR_TRACE("during EventDataReader reading: No more data on the message queue.\n");
-					LLEVENT_ERROR_TRACE(
-						"This function is not called within the virtual machine task or if the current thread is suspended.\n");
-				}
-				event_short = JFALSE;
-			} else {
-				// Set the offset of the buffer to 0 -> 0 byte has been read.
-				offset_buffer_extended_data = 0;
-				// Switch the alignment
-				data_alignment = data_alignment == (uint8_t)0 ? 1 : 0;
-			}
-		}
-
-		// Process the data if there is no error during SNI_suspendCurrentJavaThreadWithCallback
-		if (event_short == JTRUE) {
-			// Check if the buffer is 2 byte aligned. If the offset is equal to 1 -> aligned to 2.
-			// The other possible values are 0 or 2 (if 3 a new uint32_t is read from the queue), in those cases the
-			// buffer is aligned.
-			// If an alignment is done, increase the offset_extended_data_read.
-			if (offset_buffer_extended_data == (int8_t)1) {
-				offset_buffer_extended_data = 2;
-				offset_extended_data_read++;
-			}
-			// Get the two next bytes of data from the static buffer.
-			// IAR does not allow direct conversion from uint32_t* into int_to_short_t*, intermediate data required.
-			struct int_to_short_t int_to_short_data;
-			struct int_to_short_t* int_to_short_ptr = &int_to_short_data;
-
-			int_to_short_ptr->first_short = (buffer_extended_data & SHORT_ONE_MASK);
-			int_to_short_ptr->second_short = (((buffer_extended_data & SHORT_TWO_MASK)) >> SHORT_TWO_SHIFT);
-
-			if (offset_buffer_extended_data == (int8_t)0) {
-				event_short = int_to_short_ptr->first_short;
-			} else {
-				event_short = int_to_short_ptr->second_short;
-			}
-			// Increment the offset of the static buffer.
-			offset_extended_data_read += sizeof(jshort);
-			//Increment the offset of the data read.
-			offset_buffer_extended_data += (int8_t)sizeof(jshort);
-		}
-	}
-	return event_short;
+	return reader_read_short(get_reader());
 }
 
 // cppcheck-suppress [misra-c2012-8.4]: false positive, function prototype defined in event_configuration.h
 jint read_four_bytes(void) {
-	jint event_int = JTRUE;
-	// If less than 4 bytes available, throw a native IOException.
-	if (LLEVENT_IMPL_available() < sizeof(jint)) {
-		if (SNI_throwNativeIOException(EVENT_NOK,
-		                               "Less than four bytes remaining in the extended data.") == SNI_ERROR) {
-			LLEVENT_ERROR_TRACE(
-				"during EventDataReader reading: Less than four bytes remaining in the extended data.\n");
-			LLEVENT_ERROR_TRACE(
-				"This function is not called within the virtual machine task or if the current thread is suspended.\n");
-		}
-		event_int = JFALSE;
-	}
-
-	if (event_int == JTRUE) {
-		// Aligned = 4 -> read a new integer from the queue and delete the buffer (padding).
-		// If there was data in the buffer -> add the skipped bytes to the offset.
-		// There is data if the buffer is not empty (offset != -1) and everything has not been handled (offset < 4).
-		if ((offset_buffer_extended_data != (int8_t)-1) && (offset_buffer_extended_data < (int8_t)4)) {
-			offset_extended_data_read += sizeof(jint) - (uint8_t)offset_buffer_extended_data;
-		}
-		// Reset the buffer used to read bytes of an extended event.
-		buffer_extended_data = (uint32_t)NULL;
-		offset_buffer_extended_data = (int8_t)-1;
-
-		// Fetch a message from the queue. Suspend the thread if no message available.
-		UINT status = tx_queue_receive(&event_queue, &event_int, TX_NO_WAIT);
-		if (TX_SUCCESS != status) {
-			if (SNI_throwNativeIOException(EVENT_NOK, "No more data on the message queue.") == SNI_ERROR) {
-				LLEVENT_ERROR_TRACE("during EventDataReader reading: No more data on the message queue.\n");
-				LLEVENT_ERROR_TRACE(
-					"This function is not called within the virtual machine task or if the current thread is suspended.\n");
-			}
-			event_int = JFALSE;
-		} else {
-			// Increment the offset of the data read.
-			offset_extended_data_read += sizeof(jint);
-			// Switch the alignment
-			data_alignment = data_alignment == (uint8_t)0 ? 1 : 0;
-		}
-	}
-	return event_int;
+	return reader_read_int(get_reader());
 }
 
 // cppcheck-suppress [misra-c2012-8.4]: false positive, function prototype defined in event_configuration.h
 jlong read_eight_bytes(void) {
-	// Method status
-	jboolean read_status = JTRUE;
-	jlong return_value = 0;
-	// If less than 8 bytes available (or 4 bytes if the first par of the long value has been read), throw a native
-	// IOException.
-	if (LLEVENT_IMPL_available() < sizeof(jlong)) {
-		if (SNI_throwNativeIOException(EVENT_NOK,
-		                               "Less than eight bytes remaining in the extended data.") == SNI_ERROR) {
-			LLEVENT_ERROR_TRACE(
-				"during EventDataReader reading: Less than eight bytes remaining in the extended data.\n");
-			LLEVENT_ERROR_TRACE(
-				"This function is not called within the virtual machine task or if the current thread is suspended.\n");
-		}
-		read_status = JFALSE;
-	}
-
-	if (read_status == (jboolean)JTRUE) {
-		// cppcheck-suppress [misra-c2012-19.2]: the union keyword here is useful to parse the data structure.
-		union {
-			jint int_values[2];
-			jlong long_value;
-		} event_long; // cppcheck-suppress [misra-c2012-19.2]: the union keyword here is useful to parse the data
-		              // structure.
-
-		jint event_value = 0;
-
-		// Aligned = 8 -> delete the buffer (padding).
-		// If there was data in the buffer -> add the skipped bytes to the offset.
-		// There is data if the buffer is not empty (offset != -1) and everything has not been handled (offset < 4).
-		if ((offset_buffer_extended_data != (int8_t)-1) && (offset_buffer_extended_data < (int8_t)4)) {
-			offset_extended_data_read += sizeof(jint) - (uint8_t)offset_buffer_extended_data;
-		}
-		// Reset the buffer used to read bytes of an extended event.
-		buffer_extended_data = (uint32_t)NULL;
-		offset_buffer_extended_data = (int8_t)-1;
-
-		// If the data is not 8 bytes aligned, skip 4 bytes from the queue.
-		if (data_alignment != (uint8_t)1) {
-			UINT status = tx_queue_receive(&event_queue, &event_value, TX_NO_WAIT);
-			if (TX_SUCCESS != status) {
-				if (SNI_throwNativeIOException(EVENT_NOK, "No more data on the message queue.") == SNI_ERROR) {
-					LLEVENT_ERROR_TRACE("during EventDataReader reading: No more data on the message queue.\n");
-					LLEVENT_ERROR_TRACE(
-						"This function is not called within the virtual machine task or if the current thread is suspended.\n");
-				}
-				read_status = JFALSE;
-			} else {
-				// Increment the offset of the data read.
-				offset_extended_data_read += sizeof(jint);
-				// Switch the alignment
-				data_alignment = data_alignment == (uint8_t)0 ? 1 : 0;
-			}
-		}
-		// Continue to read the eight bytes if there is no error during alignment reading.
-		if (read_status == (jboolean)JTRUE) {
-			// If the first part of the long has not been read, read it and store it in a static variable.
-			UINT status = tx_queue_receive(&event_queue, &event_value, TX_NO_WAIT);
-			if (TX_SUCCESS != status) {
-				if (SNI_throwNativeIOException(EVENT_NOK, "No more data on the message queue.") == SNI_ERROR) {
-					LLEVENT_ERROR_TRACE("during EventDataReader reading: No more data on the message queue.\n");
-					LLEVENT_ERROR_TRACE(
-						"This function is not called within the virtual machine task or if the current thread is suspended.\n");
-				}
-				read_status = JFALSE;
-			} else {
-				// Increment the offset of the data read.
-				offset_extended_data_read += sizeof(jint);
-				//Store the first part of the long in a static variable.
-				first_long_value = event_value;
-				// Switch the alignment
-				data_alignment = data_alignment == (uint8_t)0 ? 1 : 0;
-			}
-			// Continue to read the eight bytes if there is no error during pervious call to
-			// SNI_suspendCurrentJavaThreadWithCallback
-			if (read_status == (jboolean)JTRUE) {
-				// Get the second part of the long. Suspend the thread if no message available.
-				UINT status = tx_queue_receive(&event_queue, &event_value, TX_NO_WAIT);
-				if (TX_SUCCESS != status) {
-					if (SNI_throwNativeIOException(EVENT_NOK, "No more data on the message queue.") == SNI_ERROR) {
-						LLEVENT_ERROR_TRACE("during EventDataReader reading: No more data on the message queue.\n");
-						LLEVENT_ERROR_TRACE(
-							"This function is not called within the virtual machine task or if the current thread is suspended.\n");
-					}
-				} else {
-					// Increment the offset of the data read.
-					offset_extended_data_read += sizeof(jint);
-					// Switch the alignment
-					data_alignment = data_alignment == (uint8_t)0 ? 1 : 0;
-					// Convert the two int32_t to a long value (64 bits).
-					event_long.int_values[0] = first_long_value;
-					event_long.int_values[1] = event_value;
-					return_value = event_long.long_value;
-				}
-			}
-		}
-	}
-
-	return return_value;
+	return reader_read_long(get_reader());
 }
 
 #ifdef __cplusplus
@@ -0,0 +1,276 @@
+/*
+ * C
+ *
+ * Copyright 2026 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/**
+ * @file
+ * @brief LLEVENT replay log of the ThreadX implementation: capture of the accepted events and replay of a log.
+ * @author MicroEJ Developer Team
+ * @version 1.0.1
+ */
+
+// -----------------------------------------------------------------------------
+// Includes
+// -----------------------------------------------------------------------------
+
+#include "LLEVENT_replay.h"
+#include "LLEVENT.h"
+#include "LLEVENT_framing.h"
+#include "event_configuration.h"
+#include "tx_api.h"
+#include <stdio.h>
+#include <string.h>
+
+#if EVENT_REPLAY_LOG_SUPPORT == 1
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if (EVENT_REPLAY_LOG_SIZE < 16) || ((EVENT_REPLAY_LOG_SIZE % 4) != 0)
+#error "EVENT_REPLAY_LOG_SIZE must be a multiple of 4, at least 16."
+#endif
+
+// -----------------------------------------------------------------------------
+// Macros and Defines
+// -----------------------------------------------------------------------------
+
+// Number of 32-bit words of the ring of the log.
+#define LOG_WORDS ((uint32_t)EVENT_REPLAY_LOG_SIZE / (uint32_t)sizeof(uint32_t))
+
+// Number of words of a record before the data of an extended event: the first word of the event and its timestamp.
+#define RECORD_HEADER_WORDS (2u)
+
+// Number of times an event that does not fit in its queue is offered again by LLEVENT_REPLAY_replay(), one tick apart.
+#define REPLAY_FULL_RETRIES (1000u)
+
+// -----------------------------------------------------------------------------
+// Private global variables
+// -----------------------------------------------------------------------------
+
+// The ring of the log. One word is never written, so that a full ring is not mistaken for an empty one.
+static uint32_t log_words[LOG_WORDS] EVENT_STORAGE_ATTRIBUTE;
+
+// The index of the next word reserved, only written by the producers with the interrupts disabled.
+static volatile uint32_t log_write_index = 0;
+
+// The index following the last record completely copied, only written with the interrupts disabled. The records
+// reserved after it are not flushed yet.
+static volatile uint32_t log_commit_index = 0;
+
+// The number of records reserved and still being copied, only written with the interrupts disabled.
+static volatile uint32_t copied_records = 0;
+
+// The index of the next word flushed, only written by LLEVENT_REPLAY_flush().
+static volatile uint32_t log_read_index = 0;
+
+// The number of events dropped because the ring was full, only written with the interrupts disabled.
+static volatile uint32_t dropped_events = 0;
+
+// -----------------------------------------------------------------------------
+// Private function definition
+// -----------------------------------------------------------------------------
+
+/**
+ * Gets the number of words that can be written into the ring.
+ */
+static uint32_t get_log_free_words(uint32_t write_index) {
+	uint32_t read_index = log_read_index;
+	return (write_index >= read_index) ? ((LOG_WORDS - 1u) - (write_index - read_index)) :
+	       ((read_index - write_index) - 1u);
+}
+
+/**
+ * Writes a word into the ring.
+ *
+ * @return the index of the next word.
+ */
+static uint32_t write_log_word(uint32_t index, uint32_t word) {
+	log_words[index] = word;
+	index++;
+	return (index == LOG_WORDS) ? 0u : index;
+}
+
+/**
+ * Writes data into the ring, its last word padded with 0.
+ *
+ * @return the index of the word following the data.
+ */
+static uint32_t write_log_data(uint32_t index, const uint8_t* data, uint32_t data_length) {
+	uint32_t words = LLEVENT_FRAMING_get_payload_words(data_length);
+	uint32_t last_index = index + words - 1u;
+	log_words[(last_index >= LOG_WORDS) ? (last_index - LOG_WORDS) : last_index] = 0;
+
+	// The data may wrap around the end of the ring.
+	uint32_t first_length = (LOG_WORDS - index) * (uint32_t)sizeof(uint32_t);
+	if (first_length > data_length) {
+		first_length = data_length;
+	}
+	(void)memcpy(&log_words[index], data, first_length);
+	(void)memcpy(&log_words[0], &data[first_length], data_length - first_length);
+
+	index += words;
+	return (index >= LOG_WORDS) ? (index - LOG_WORDS) : index;
+}
+
+/**
+ * Writes the words [begin_index, end_index[ of the ring.
+ *
+ * @return the number of bytes written.
+ */
+static uint32_t flush_log_words(uint32_t begin_index, uint32_t end_index) {
+	uint32_t length = (end_index - begin_index) * (uint32_t)sizeof(uint32_t);
+	if (0u != length) {
+		EVENT_REPLAY_LOG_WRITE((const uint8_t*)&log_words[begin_index], length);
+	}
+	return length;
+}
+
+/**
+ * Offers an event of a log, again while its queue is full.
+ *
+ * @return true if the event has been offered.
+ */
+static bool replay_event(uint32_t event_message, const uint8_t* data) {
+	int32_t type = (int32_t)LLEVENT_FRAMING_get_type(event_message);
+	int32_t event_data = (int32_t)LLEVENT_FRAMING_get_data(event_message);
+	int32_t status = ERR_FIFO_FULL;
+	for (uint32_t i = 0; (i <= REPLAY_FULL_RETRIES) && (ERR_FIFO_FULL == status); i++) {
+		if (0u != i) {
+			// Unused return value: the thread is not resumed before the end of the sleep.
+			UINT sleep_status = tx_thread_sleep(1);
+			(void)sleep_status;
+		}
+		if (LLEVENT_FRAMING_is_extended(event_message)) {
+			// cppcheck-suppress [misra-c2012-11.8]: the data of the log is only read by LLEVENT_offerExtendedEvent().
+			status = LLEVENT_offerExtendedEvent(type, (void*)data, event_data);
+		} else {
+			status = LLEVENT_offerEvent(type, event_data);
+		}
+	}
+	return NO_ERR == status;
+}
+
+// -----------------------------------------------------------------------------
+// Public function definition
+// -----------------------------------------------------------------------------
+
+void LLEVENT_REPLAY_record(uint32_t event_message, const void* data) {
+	uint32_t data_length = LLEVENT_FRAMING_is_extended(event_message) ? LLEVENT_FRAMING_get_data(event_message) : 0u;
+	uint32_t words = RECORD_HEADER_WORDS + LLEVENT_FRAMING_get_payload_words(data_length);
+	uint32_t timestamp = EVENT_TIMESTAMP();
+
+	// Only the space of the record is reserved with the interrupts disabled: the producers and the interrupt handlers
+	// never wait for the flush, nor for the copy of the data of another record.
+	UINT interrupt_state = tx_interrupt_control(TX_INT_DISABLE);
+	uint32_t write_index = log_write_index;
+	bool reserved = words <= get_log_free_words(write_index);
+	if (reserved) {
+		uint32_t end_index = write_index + words;
+		log_write_index = (end_index >= LOG_WORDS) ? (end_index - LOG_WORDS) : end_index;
+		copied_records++;
+	} else {
+		dropped_events++;
+	}
+	(void)tx_interrupt_control(interrupt_state);
+
+	if (reserved) {
+		write_index = write_log_word(write_index, event_message);
+		write_index = write_log_word(write_index, timestamp);
+		if (0u != data_length) {
+			// cppcheck-suppress [misra-c2012-11.5]: conversion from void* to uint8_t* necessary to copy the input data.
+			write_index = write_log_data(write_index, (const uint8_t*)data, data_length);
+		}
+		(void)write_index;
+
+		// The reserved records are flushed once none of them is still being copied.
+		interrupt_state = tx_interrupt_control(TX_INT_DISABLE);
+		copied_records--;
+		if (0u == copied_records) {
+			log_commit_index = log_write_index;
+		}
+		(void)tx_interrupt_control(interrupt_state);
+	}
+}
+
+uint32_t LLEVENT_REPLAY_flush(void) {
+	// The records before the commit index are completely copied.
+	UINT interrupt_state = tx_interrupt_control(TX_INT_DISABLE);
+	uint32_t write_index = log_commit_index;
+	(void)tx_interrupt_control(interrupt_state);
+
+	uint32_t read_index = log_read_index;
+	uint32_t length = 0;
+	if (write_index < read_index) {
+		// The records wrap around the end of the ring.
+		length += flush_log_words(read_index, LOG_WORDS);
+		read_index = 0;
+	}
+	length += flush_log_words(read_index, write_index);
+
+	// Free the space of the records once they have been written.
+	log_read_index = write_index;
+	return length;
+}
+
+uint32_t LLEVENT_REPLAY_get_dropped_events(void) {
+	return dropped_events;
+}
+
+int32_t LLEVENT_REPLAY_replay(const void* log, uint32_t length, bool original_timing) {
+	// cppcheck-suppress [misra-c2012-11.5]: conversion from void* to uint8_t* necessary to parse the log.
+	const uint8_t* bytes = (const uint8_t*)log;
+	const uint32_t header_length = RECORD_HEADER_WORDS * (uint32_t)sizeof(uint32_t);
+	int32_t offered_events = 0;
+	bool valid = true;
+	ULONG start_time = tx_time_get();
+	uint32_t first_timestamp = 0;
+
+	for (uint32_t offset = 0; valid && (offset < length);) {
+		uint32_t event_message = 0;
+		uint32_t timestamp = 0;
+		uint32_t record_length = header_length;
+		if ((length - offset) >= header_length) {
+			(void)memcpy(&event_message, &bytes[offset], sizeof(uint32_t));
+			(void)memcpy(&timestamp, &bytes[offset + (uint32_t)sizeof(uint32_t)], sizeof(uint32_t));
+			if (LLEVENT_FRAMING_is_extended(event_message)) {
+				record_length += LLEVENT_FRAMING_get_payload_words(LLEVENT_FRAMING_get_data(event_message)) *
+				                 (uint32_t)sizeof(uint32_t);
+			}
+		}
+		valid = record_length <= (length - offset);
+
+		if (valid) {
+			if (0u == offset) {
+				first_timestamp = timestamp;
+			} else if (original_timing) {
+				// Wait until the time of the event relative to the first event, without accumulating the drift of the
+				// offers.
+				ULONG elapsed = tx_time_get() - start_time;
+				ULONG event_time = EVENT_REPLAY_TICKS(timestamp - first_timestamp);
+				if (event_time > elapsed) {
+					// Unused return value: the thread is not resumed before the end of the sleep.
+					UINT sleep_status = tx_thread_sleep(event_time - elapsed);
+					(void)sleep_status;
+				}
+			} else {
+				// Offered as fast as possible.
+			}
+			if (replay_event(event_message, &bytes[offset + header_length])) {
+				offered_events++;
+			}
+			offset += record_length;
+		}
+	}
+
+	return valid ? offered_events : (int32_t)-1;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // EVENT_REPLAY_LOG_SUPPORT == 1
@@ -0,0 +1,248 @@
+/*
+ * C
+ *
+ * Copyright 2026 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/**
+ * @file
+ * @brief LLEVENT instrumentation of the ThreadX implementation.
+ * @author MicroEJ Developer Team
+ * @version 1.0.1
+ */
+
+// -----------------------------------------------------------------------------
+// Includes
+// -----------------------------------------------------------------------------
+
+#include "LLEVENT_statistics.h"
+#include "LLEVENT_framing.h"
+#include "event_configuration.h"
+#include <stddef.h>
+
+#if EVENT_INSTRUMENTATION == 1
+
+#if EVENT_LOCK_FREE_QUEUE == 1
+#include <stdatomic.h>
+#endif // EVENT_LOCK_FREE_QUEUE == 1
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// -----------------------------------------------------------------------------
+// Private global variables
+// -----------------------------------------------------------------------------
+
+/**
+ * A statistic counter. With the lock-free backend, the counters are updated concurrently by the producers. Otherwise,
+ * they are updated in the critical section protecting the event queues (except the latencies, only updated by the Java
+ * thread).
+ */
+#if EVENT_LOCK_FREE_QUEUE == 1
+typedef _Atomic uint32_t event_counter_t;
+#else
+typedef volatile uint32_t event_counter_t;
+#endif // EVENT_LOCK_FREE_QUEUE == 1
+
+/**
+ * The statistics of the event queues (@see LLEVENT_IMPL_get_statistic).
+ */
+typedef struct {
+	event_counter_t offered[LLEVENT_FRAMING_MAX_TYPE_ID];
+	event_counter_t dropped[LLEVENT_FRAMING_MAX_TYPE_ID];
+	event_counter_t queue_high_water[EVENT_QUEUE_COUNT];
+	event_counter_t payload_high_water[EVENT_QUEUE_COUNT];
+	event_counter_t contentions;
+	event_counter_t contention_time;
+	event_counter_t latency[EVENT_LATENCY_HISTOGRAM_BINS];
+	event_counter_t filtered[LLEVENT_FRAMING_MAX_TYPE_ID];
+} event_statistics_t;
+
+static event_statistics_t event_statistics = { 0 };
+
+// -----------------------------------------------------------------------------
+// Private function definition
+// -----------------------------------------------------------------------------
+
+/**
+ * Adds a value to a counter.
+ */
+static void counter_add(event_counter_t* counter, uint32_t value) {
+#if EVENT_LOCK_FREE_QUEUE == 1
+	(void)atomic_fetch_add(counter, value);
+#else
+	*counter += value;
+#endif // EVENT_LOCK_FREE_QUEUE == 1
+}
+
+/**
+ * Raises a counter to a value if it is lower.
+ */
+static void counter_max(event_counter_t* counter, uint32_t value) {
+#if EVENT_LOCK_FREE_QUEUE == 1
+	uint32_t current = atomic_load(counter);
+	// On failure, current is updated with the value set by another producer.
+	while ((current < value) && !atomic_compare_exchange_weak(counter, &current, value)) {
+	}
+#else
+	if (*counter < value) {
+		*counter = value;
+	}
+#endif // EVENT_LOCK_FREE_QUEUE == 1
+}
+
+/**
+ * Gets the value of a counter.
+ */
+static uint32_t counter_get(event_counter_t* counter) {
+#if EVENT_LOCK_FREE_QUEUE == 1
+	return atomic_load(counter);
+#else
+	return *counter;
+#endif // EVENT_LOCK_FREE_QUEUE == 1
+}
+
+/**
+ * Sets consecutive counters to 0.
+ */
+static void counters_reset(event_counter_t* counters, uint32_t count) {
+	for (uint32_t i = 0; i < count; i++) {
+#if EVENT_LOCK_FREE_QUEUE == 1
+		atomic_store(&counters[i], 0u);
+#else
+		counters[i] = 0;
+#endif // EVENT_LOCK_FREE_QUEUE == 1
+	}
+}
+
+/**
+ * Gets the counter of a statistic.
+ *
+ * @return the counter, NULL if the statistic or the index is invalid.
+ */
+static event_counter_t* get_counter(uint32_t statistic, uint32_t index) {
+	event_counter_t* counter = NULL;
+	switch (statistic) {
+	case LLEVENT_STATISTIC_OFFERED:
+		counter = (index < (uint32_t)LLEVENT_FRAMING_MAX_TYPE_ID) ? &event_statistics.offered[index] : NULL;
+		break;
+	case LLEVENT_STATISTIC_DROPPED:
+		counter = (index < (uint32_t)LLEVENT_FRAMING_MAX_TYPE_ID) ? &event_statistics.dropped[index] : NULL;
+		break;
+	case LLEVENT_STATISTIC_QUEUE_HIGH_WATER:
+		counter = (index < (uint32_t)EVENT_QUEUE_COUNT) ? &event_statistics.queue_high_water[index] : NULL;
+		break;
+	case LLEVENT_STATISTIC_PAYLOAD_HIGH_WATER:
+		counter = (index < (uint32_t)EVENT_QUEUE_COUNT) ? &event_statistics.payload_high_water[index] : NULL;
+		break;
+	case LLEVENT_STATISTIC_CONTENTIONS:
+		counter = &event_statistics.contentions;
+		break;
+	case LLEVENT_STATISTIC_CONTENTION_TIME:
+		counter = &event_statistics.contention_time;
+		break;
+	case LLEVENT_STATISTIC_LATENCY:
+		counter = (index < (uint32_t)EVENT_LATENCY_HISTOGRAM_BINS) ? &event_statistics.latency[index] : NULL;
+		break;
+	case LLEVENT_STATISTIC_FILTERED:
+		counter = (index < (uint32_t)LLEVENT_FRAMING_MAX_TYPE_ID) ? &event_statistics.filtered[index] : NULL;
+		break;
+	default:
+		// Invalid statistic.
+		break;
+	}
+	return counter;
+}
+
+// -----------------------------------------------------------------------------
+// Public function definition
+// -----------------------------------------------------------------------------
+
+/**
+ * Gets a statistic of the event queue.
+ *
+ * @param statistic the statistic, one of the LLEVENT_STATISTIC_* values.
+ * @param index the index of the value (see the statistic).
+ * @return the value, 0 if the statistic or the index is invalid.
+ */
+jint LLEVENT_IMPL_get_statistic(jint statistic, jint index) {
+	event_counter_t* counter = get_counter((uint32_t)statistic, (uint32_t)index);
+	return (NULL != counter) ? (jint)counter_get(counter) : 0;
+}
+
+/**
+ * Resets all the statistics of the event queue. The events offered concurrently may not be counted.
+ */
+void LLEVENT_IMPL_reset_statistics(void) {
+	counters_reset(&event_statistics.offered[0], LLEVENT_FRAMING_MAX_TYPE_ID);
+	counters_reset(&event_statistics.dropped[0], LLEVENT_FRAMING_MAX_TYPE_ID);
+	counters_reset(&event_statistics.queue_high_water[0], EVENT_QUEUE_COUNT);
+	counters_reset(&event_statistics.payload_high_water[0], EVENT_QUEUE_COUNT);
+	counters_reset(&event_statistics.contentions, 1);
+	counters_reset(&event_statistics.contention_time, 1);
+	counters_reset(&event_statistics.latency[0], EVENT_LATENCY_HISTOGRAM_BINS);
+	counters_reset(&event_statistics.filtered[0], LLEVENT_FRAMING_MAX_TYPE_ID);
+}
+
+/**
+ * Records an offer of an event.
+ *
+ * @param type the type of the event.
+ * @param offered true if the event has been offered, false if it has been dropped.
+ */
+void LLEVENT_STATISTICS_record_offer(uint32_t type, bool offered) {
+	counter_add(offered ? &event_statistics.offered[type] : &event_statistics.dropped[type], 1);
+}
+
+/**
+ * Records an event discarded because its type is disabled.
+ *
+ * @param type the type of the event.
+ */
+void LLEVENT_STATISTICS_record_filtered(uint32_t type) {
+	counter_add(&event_statistics.filtered[type], 1);
+}
+
+/**
+ * Records the usage of a queue after an event has been sent.
+ *
+ * @param priority the priority of the queue.
+ * @param events the number of events (words with the lock-free backend) in the queue.
+ * @param payload_words the number of words used in the payload buffer of the queue.
+ */
+void LLEVENT_STATISTICS_record_queue_usage(uint32_t priority, uint32_t events, uint32_t payload_words) {
+	counter_max(&event_statistics.queue_high_water[priority], events);
+	counter_max(&event_statistics.payload_high_water[priority], payload_words);
+}
+
+/**
+ * Records a contention on the critical section protecting the event queues.
+ *
+ * @param wait_time the time spent waiting, in EVENT_TIMESTAMP() units.
+ */
+void LLEVENT_STATISTICS_record_contention(uint32_t wait_time) {
+	counter_add(&event_statistics.contentions, 1);
+	counter_add(&event_statistics.contention_time, wait_time);
+}
+
+/**
+ * Records the enqueue-to-dequeue latency of an event in the log2 histogram.
+ *
+ * @param latency the latency, in EVENT_TIMESTAMP() units.
+ */
+void LLEVENT_STATISTICS_record_latency(uint32_t latency) {
+	uint32_t bin = 0;
+	while ((latency != 0u) && (bin < ((uint32_t)EVENT_LATENCY_HISTOGRAM_BINS - 1u))) {
+		latency >>= 1;
+		bin++;
+	}
+	counter_add(&event_statistics.latency[bin], 1);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // EVENT_INSTRUMENTATION == 1
@@ -0,0 +1,62 @@
+/*
+ * C
+ *
+ * Copyright 2026 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/**
+ * @file
+ * @brief LLEVENT SystemView module of the trace hooks of the ThreadX implementation.
+ * @author MicroEJ Developer Team
+ * @version 1.0.1
+ */
+
+// -----------------------------------------------------------------------------
+// Includes
+// -----------------------------------------------------------------------------
+
+#include "LLEVENT_trace.h"
+#include "event_configuration.h"
+#include <stddef.h>
+
+#if EVENT_TRACE == EVENT_TRACE_SYSTEMVIEW
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// -----------------------------------------------------------------------------
+// Global variables
+// -----------------------------------------------------------------------------
+
+/**
+ * The description of the trace events, in the order of their LLEVENT_TRACE_EVENT_* offsets.
+ */
+// cppcheck-suppress [misra-c2012-8.7]: API variable, external linkage mandatory.
+SEGGER_SYSVIEW_MODULE LLEVENT_TRACE_module = {
+	"M=LLEVENT, " \
+	"0 Offer event=%x priority=%u, " \
+	"1 QueueFull event=%x priority=%u, " \
+	"2 Dequeue event=%x priority=%u, " \
+	"3 Suspend thread=%d consumer=%u, " \
+	"4 Resume thread=%d consumer=%u",
+	LLEVENT_TRACE_EVENT_COUNT,
+	0,
+	NULL,
+	NULL,
+};
+
+// -----------------------------------------------------------------------------
+// Public function definition
+// -----------------------------------------------------------------------------
+
+void LLEVENT_TRACE_initialize(void) {
+	SEGGER_SYSVIEW_RegisterModule(&LLEVENT_TRACE_module);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // EVENT_TRACE == EVENT_TRACE_SYSTEMVIEW
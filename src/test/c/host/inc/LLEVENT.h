@@ -0,0 +1,35 @@
+/*
+ * C
+ *
+ * Copyright 2026 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+#ifndef  LLEVENT_H
+#define  LLEVENT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @file
+ * @brief LLEVENT API, for a host build (provided by the VEE Port otherwise).
+ * @author MicroEJ Developer Team
+ * @version 1.0.1
+ */
+
+#include <stdint.h>
+
+#define NO_ERR                  (0)
+#define ERR_FIFO_FULL           (-1)
+#define ERR_WRONG_ARGS          (-2)
+
+int32_t LLEVENT_offerEvent(int32_t type, int32_t data);
+int32_t LLEVENT_offerExtendedEvent(int32_t type, void* data, int32_t data_length);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // LLEVENT_H
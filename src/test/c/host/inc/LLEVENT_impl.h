@@ -0,0 +1,51 @@
+/*
+ * C
+ *
+ * Copyright 2026 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+#ifndef  LLEVENT_IMPL_H
+#define  LLEVENT_IMPL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @file
+ * @brief LLEVENT_IMPL API, for a host build (provided by the VEE Port otherwise).
+ * @author MicroEJ Developer Team
+ * @version 1.0.1
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include "sni.h"
+
+void LLEVENT_IMPL_initialize(void);
+bool LLEVENT_IMPL_offer_event(uint32_t type, uint32_t data);
+bool LLEVENT_IMPL_offer_extended_event(uint32_t type, const void* data, uint32_t data_length);
+uint32_t LLEVENT_IMPL_wait_event(void);
+void LLEVENT_IMPL_start_read_extended_data(uint32_t data_length);
+void LLEVENT_IMPL_end_read_extended_data(void);
+jboolean LLEVENT_IMPL_read_boolean(void);
+jbyte LLEVENT_IMPL_read_byte(void);
+jchar LLEVENT_IMPL_read_char(void);
+jdouble LLEVENT_IMPL_read_double(void);
+jfloat LLEVENT_IMPL_read_float(void);
+jint LLEVENT_IMPL_read(uint8_t* b, uint32_t off, uint32_t len);
+jint LLEVENT_IMPL_read_int(void);
+jlong LLEVENT_IMPL_read_long(void);
+jshort LLEVENT_IMPL_read_short(void);
+jboolean LLEVENT_IMPL_read_unsigned_byte(void);
+jchar LLEVENT_IMPL_read_unsigned_short(void);
+jint LLEVENT_IMPL_skip_bytes(uint32_t n);
+uint32_t LLEVENT_IMPL_available(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // LLEVENT_IMPL_H
@@ -0,0 +1,56 @@
+/*
+ * C
+ *
+ * Copyright 2026 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+#ifndef  SNI_H
+#define  SNI_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @file
+ * @brief Subset of the SNI API used by the LLEVENT implementation, for a host build. The functions are implemented by
+ * SNI_stub.c.
+ * @author MicroEJ Developer Team
+ * @version 1.0.1
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+typedef int8_t jbyte;
+typedef uint8_t jboolean;
+typedef int16_t jshort;
+typedef uint16_t jchar;
+typedef int32_t jint;
+typedef int64_t jlong;
+typedef float jfloat;
+typedef double jdouble;
+
+#define JTRUE                   ((jboolean)1)
+#define JFALSE                  ((jboolean)0)
+
+#define SNI_OK                  (0)
+#define SNI_ERROR               (-1)
+#define SNI_IGNORED_RETURNED_VALUE (-9999)
+
+typedef void (*SNI_callback)(void);
+
+int32_t SNI_getCurrentJavaThreadID(void);
+int32_t SNI_suspendCurrentJavaThreadWithCallback(int64_t timeout, SNI_callback callback, void* callback_suspend_arg);
+int32_t SNI_resumeJavaThread(int32_t java_thread_id);
+int32_t SNI_throwNativeIOException(int32_t error_code, const char* message);
+bool SNI_isExceptionPending(void);
+int32_t SNI_clearPendingException(void);
+int32_t SNI_getArrayLength(const void* array);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SNI_H
@@ -0,0 +1,154 @@
+/*
+ * C
+ *
+ * Copyright 2026 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+#ifndef  TX_API_H
+#define  TX_API_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @file
+ * @brief Subset of the ThreadX API used by the LLEVENT implementation and its tests, for a host build.
+ *
+ * The services are backed by POSIX threads, so that the producers, the timers and the deferred wakeup thread run
+ * concurrently with the thread running the tests. The priorities, the preemption thresholds and the given stacks of
+ * the threads are ignored: they run on the stacks allocated by pthread_create(), scheduled by the host. A tick is
+ * 1 ms. The interrupt lockout of tx_interrupt_control() is a process-wide lock held while the interrupts are disabled
+ * by the calling thread.
+ * @author MicroEJ Developer Team
+ * @version 1.0.1
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include <pthread.h>
+
+typedef char CHAR;
+typedef unsigned int UINT;
+// 32 bits as on the targets: the messages of the queues are made of ULONG.
+typedef uint32_t ULONG;
+typedef void VOID;
+
+#define TX_NULL                 ((void*)0)
+
+#define TX_SUCCESS              ((UINT)0x00)
+#define TX_QUEUE_EMPTY          ((UINT)0x0A)
+#define TX_QUEUE_FULL           ((UINT)0x0B)
+#define TX_NO_INSTANCE          ((UINT)0x0D)
+#define TX_THREAD_ERROR         ((UINT)0x0E)
+#define TX_SIZE_ERROR           ((UINT)0x05)
+#define TX_NOT_AVAILABLE        ((UINT)0x1D)
+#define TX_NOT_OWNED            ((UINT)0x1E)
+#define TX_CEILING_EXCEEDED     ((UINT)0x21)
+#define TX_TIMER_ERROR          ((UINT)0x15)
+#define TX_ACTIVATE_ERROR       ((UINT)0x17)
+#define TX_FEATURE_NOT_ENABLED  ((UINT)0xFF)
+
+#define TX_NO_WAIT              ((ULONG)0)
+#define TX_WAIT_FOREVER         ((ULONG)0xFFFFFFFFUL)
+
+#define TX_INT_DISABLE          ((UINT)1)
+#define TX_INT_ENABLE           ((UINT)0)
+
+#define TX_NO_INHERIT           ((UINT)0)
+#define TX_INHERIT              ((UINT)1)
+
+#define TX_AUTO_START           ((UINT)1)
+#define TX_DONT_START           ((UINT)0)
+#define TX_NO_TIME_SLICE        ((ULONG)0)
+
+#define TX_NO_ACTIVATE          ((UINT)0)
+#define TX_AUTO_ACTIVATE        ((UINT)1)
+
+#define TX_TIMER_TICKS_PER_SECOND ((ULONG)1000)
+
+// The objects are initialized by their create service: the fields are private to tx_api_host.c.
+
+typedef struct {
+	ULONG* start;
+	ULONG capacity;
+	ULONG read_index;
+	ULONG write_index;
+	ULONG enqueued;
+	UINT message_size;
+	pthread_mutex_t lock;
+	pthread_cond_t not_empty;
+	pthread_cond_t not_full;
+} TX_QUEUE;
+
+typedef struct {
+	ULONG ownership_count;
+	pthread_t owner;
+	pthread_mutex_t lock;
+	pthread_cond_t released;
+} TX_MUTEX;
+
+typedef struct {
+	ULONG count;
+	pthread_mutex_t lock;
+	pthread_cond_t put;
+} TX_SEMAPHORE;
+
+typedef struct {
+	VOID (*entry)(ULONG);
+	ULONG input;
+	pthread_t thread;
+	bool started;
+} TX_THREAD;
+
+typedef struct {
+	VOID (*expiration_function)(ULONG);
+	ULONG expiration_input;
+	ULONG initial_ticks;
+	ULONG reschedule_ticks;
+	UINT active;
+	// The expiration time of an active timer, in ticks.
+	uint64_t expiration_time;
+	pthread_t thread;
+	pthread_mutex_t lock;
+	pthread_cond_t changed;
+} TX_TIMER;
+
+UINT tx_queue_create(TX_QUEUE* queue_ptr, CHAR* name_ptr, UINT message_size, VOID* queue_start, ULONG queue_size);
+UINT tx_queue_send(TX_QUEUE* queue_ptr, VOID* source_ptr, ULONG wait_option);
+UINT tx_queue_receive(TX_QUEUE* queue_ptr, VOID* destination_ptr, ULONG wait_option);
+UINT tx_queue_info_get(TX_QUEUE* queue_ptr, CHAR** name, ULONG* enqueued, ULONG* available_storage,
+                       TX_THREAD** first_suspended, ULONG* suspended_count, TX_QUEUE** next_queue);
+
+UINT tx_mutex_create(TX_MUTEX* mutex_ptr, CHAR* name_ptr, UINT inherit);
+UINT tx_mutex_get(TX_MUTEX* mutex_ptr, ULONG wait_option);
+UINT tx_mutex_put(TX_MUTEX* mutex_ptr);
+
+UINT tx_semaphore_create(TX_SEMAPHORE* semaphore_ptr, CHAR* name_ptr, ULONG initial_count);
+UINT tx_semaphore_get(TX_SEMAPHORE* semaphore_ptr, ULONG wait_option);
+UINT tx_semaphore_put(TX_SEMAPHORE* semaphore_ptr);
+UINT tx_semaphore_ceiling_put(TX_SEMAPHORE* semaphore_ptr, ULONG ceiling);
+
+UINT tx_thread_create(TX_THREAD* thread_ptr, CHAR* name_ptr, VOID (*entry_function)(ULONG), ULONG entry_input,
+                      VOID* stack_start, ULONG stack_size, UINT priority, UINT preempt_threshold,
+                      ULONG time_slice, UINT auto_start);
+UINT tx_thread_delete(TX_THREAD* thread_ptr);
+UINT tx_thread_sleep(ULONG timer_ticks);
+
+UINT tx_timer_create(TX_TIMER* timer_ptr, CHAR* name_ptr, VOID (*expiration_function)(ULONG), ULONG expiration_input,
+                     ULONG initial_ticks, ULONG reschedule_ticks, UINT auto_activate);
+UINT tx_timer_activate(TX_TIMER* timer_ptr);
+UINT tx_timer_deactivate(TX_TIMER* timer_ptr);
+UINT tx_timer_change(TX_TIMER* timer_ptr, ULONG initial_ticks, ULONG reschedule_ticks);
+
+UINT tx_interrupt_control(UINT new_posture);
+
+ULONG tx_time_get(VOID);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TX_API_H
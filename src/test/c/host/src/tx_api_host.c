@@ -0,0 +1,424 @@
+/*
+ * C
+ *
+ * Copyright 2026 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/**
+ * @file
+ * @brief Subset of the ThreadX API used by the LLEVENT implementation and its tests, for a host build, backed by
+ * POSIX threads.
+ * @author MicroEJ Developer Team
+ * @version 1.0.1
+ */
+
+// -----------------------------------------------------------------------------
+// Includes
+// -----------------------------------------------------------------------------
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "tx_api.h"
+#include <errno.h>
+#include <string.h>
+#include <time.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// -----------------------------------------------------------------------------
+// Macros and Defines
+// -----------------------------------------------------------------------------
+
+#define NANOSECONDS_PER_SECOND  (1000000000UL)
+#define NANOSECONDS_PER_TICK    (NANOSECONDS_PER_SECOND / TX_TIMER_TICKS_PER_SECOND)
+
+// -----------------------------------------------------------------------------
+// Private global variables
+// -----------------------------------------------------------------------------
+
+// Held while the interrupts are disabled by a thread.
+static pthread_mutex_t interrupt_lock = PTHREAD_MUTEX_INITIALIZER;
+
+// The interrupt posture of the calling thread.
+static _Thread_local UINT interrupt_posture = TX_INT_ENABLE;
+
+// -----------------------------------------------------------------------------
+// Private function definition
+// -----------------------------------------------------------------------------
+
+/**
+ * Gets the number of ticks elapsed since an arbitrary point, on the clock of the condition variables.
+ */
+static uint64_t get_time_ticks(void) {
+	struct timespec now;
+	(void)clock_gettime(CLOCK_MONOTONIC, &now);
+	return ((uint64_t)now.tv_sec * TX_TIMER_TICKS_PER_SECOND) + ((uint64_t)now.tv_nsec / NANOSECONDS_PER_TICK);
+}
+
+/**
+ * Converts a time in ticks returned by get_time_ticks() to a timespec.
+ */
+static struct timespec to_timespec(uint64_t ticks) {
+	struct timespec time;
+	time.tv_sec = (time_t)(ticks / TX_TIMER_TICKS_PER_SECOND);
+	time.tv_nsec = (long)((ticks % TX_TIMER_TICKS_PER_SECOND) * NANOSECONDS_PER_TICK);
+	return time;
+}
+
+/**
+ * Initializes a condition variable on the monotonic clock.
+ */
+static void init_condition(pthread_cond_t* condition) {
+	pthread_condattr_t attributes;
+	(void)pthread_condattr_init(&attributes);
+	(void)pthread_condattr_setclock(&attributes, CLOCK_MONOTONIC);
+	(void)pthread_cond_init(condition, &attributes);
+	(void)pthread_condattr_destroy(&attributes);
+}
+
+/**
+ * Waits for a condition variable, as long as allowed by a ThreadX wait option. The lock is held by the caller, who
+ * checks its condition again when this function returns true.
+ *
+ * @param deadline the time when the wait option expires, computed once by the caller with get_time_ticks().
+ * @return false if the wait option does not allow to wait or has expired, true otherwise.
+ */
+static bool wait_condition(pthread_cond_t* condition, pthread_mutex_t* lock, ULONG wait_option, uint64_t deadline) {
+	bool waited = false;
+	if (TX_WAIT_FOREVER == wait_option) {
+		(void)pthread_cond_wait(condition, lock);
+		waited = true;
+	} else if (TX_NO_WAIT != wait_option) {
+		struct timespec time = to_timespec(deadline);
+		waited = ETIMEDOUT != pthread_cond_timedwait(condition, lock, &time);
+	} else {
+		// The caller does not wait.
+	}
+	return waited;
+}
+
+/**
+ * Entry point of the POSIX thread of a ThreadX thread.
+ */
+static void* thread_entry(void* thread) {
+	// cppcheck-suppress [misra-c2012-11.5]: the thread is given as a void* by pthread_create().
+	TX_THREAD* thread_ptr = (TX_THREAD*)thread;
+	thread_ptr->entry(thread_ptr->input);
+	return NULL;
+}
+
+/**
+ * Entry point of the POSIX thread of a timer: calls the expiration function of the timer each time it expires, like
+ * the ThreadX timer thread.
+ */
+static void* timer_entry(void* timer) {
+	// cppcheck-suppress [misra-c2012-11.5]: the timer is given as a void* by pthread_create().
+	TX_TIMER* timer_ptr = (TX_TIMER*)timer;
+	(void)pthread_mutex_lock(&timer_ptr->lock);
+	while (true) {
+		if (TX_NO_ACTIVATE == timer_ptr->active) {
+			(void)pthread_cond_wait(&timer_ptr->changed, &timer_ptr->lock);
+		} else if (get_time_ticks() < timer_ptr->expiration_time) {
+			struct timespec time = to_timespec(timer_ptr->expiration_time);
+			(void)pthread_cond_timedwait(&timer_ptr->changed, &timer_ptr->lock, &time);
+		} else {
+			if (0u != timer_ptr->reschedule_ticks) {
+				timer_ptr->expiration_time += timer_ptr->reschedule_ticks;
+			} else {
+				timer_ptr->active = TX_NO_ACTIVATE;
+			}
+			// The expiration function may use the timer services.
+			(void)pthread_mutex_unlock(&timer_ptr->lock);
+			timer_ptr->expiration_function(timer_ptr->expiration_input);
+			(void)pthread_mutex_lock(&timer_ptr->lock);
+		}
+	}
+	return NULL;
+}
+
+// -----------------------------------------------------------------------------
+// Public function definition
+// -----------------------------------------------------------------------------
+
+UINT tx_queue_create(TX_QUEUE* queue_ptr, CHAR* name_ptr, UINT message_size, VOID* queue_start, ULONG queue_size) {
+	(void)name_ptr;
+	UINT status = TX_SIZE_ERROR;
+	ULONG capacity = queue_size / ((ULONG)message_size * (ULONG)sizeof(ULONG));
+	if (capacity > 0u) {
+		// cppcheck-suppress [misra-c2012-11.5]: the queue storage is given as a void*.
+		queue_ptr->start = (ULONG*)queue_start;
+		queue_ptr->capacity = capacity;
+		queue_ptr->read_index = 0;
+		queue_ptr->write_index = 0;
+		queue_ptr->enqueued = 0;
+		queue_ptr->message_size = message_size;
+		(void)pthread_mutex_init(&queue_ptr->lock, NULL);
+		init_condition(&queue_ptr->not_empty);
+		init_condition(&queue_ptr->not_full);
+		status = TX_SUCCESS;
+	}
+	return status;
+}
+
+UINT tx_queue_send(TX_QUEUE* queue_ptr, VOID* source_ptr, ULONG wait_option) {
+	UINT status = TX_QUEUE_FULL;
+	uint64_t deadline = get_time_ticks() + wait_option;
+	(void)pthread_mutex_lock(&queue_ptr->lock);
+	while ((queue_ptr->enqueued == queue_ptr->capacity) &&
+	       wait_condition(&queue_ptr->not_full, &queue_ptr->lock, wait_option, deadline)) {
+		// Wait for a message to be received.
+	}
+	if (queue_ptr->enqueued < queue_ptr->capacity) {
+		(void)memcpy(&queue_ptr->start[queue_ptr->write_index * queue_ptr->message_size], source_ptr,
+		             queue_ptr->message_size * sizeof(ULONG));
+		queue_ptr->write_index = (queue_ptr->write_index + 1u) % queue_ptr->capacity;
+		queue_ptr->enqueued++;
+		(void)pthread_cond_signal(&queue_ptr->not_empty);
+		status = TX_SUCCESS;
+	}
+	(void)pthread_mutex_unlock(&queue_ptr->lock);
+	return status;
+}
+
+UINT tx_queue_receive(TX_QUEUE* queue_ptr, VOID* destination_ptr, ULONG wait_option) {
+	UINT status = TX_QUEUE_EMPTY;
+	uint64_t deadline = get_time_ticks() + wait_option;
+	(void)pthread_mutex_lock(&queue_ptr->lock);
+	while ((0u == queue_ptr->enqueued) &&
+	       wait_condition(&queue_ptr->not_empty, &queue_ptr->lock, wait_option, deadline)) {
+		// Wait for a message to be sent.
+	}
+	if (queue_ptr->enqueued > 0u) {
+		(void)memcpy(destination_ptr, &queue_ptr->start[queue_ptr->read_index * queue_ptr->message_size],
+		             queue_ptr->message_size * sizeof(ULONG));
+		queue_ptr->read_index = (queue_ptr->read_index + 1u) % queue_ptr->capacity;
+		queue_ptr->enqueued--;
+		(void)pthread_cond_signal(&queue_ptr->not_full);
+		status = TX_SUCCESS;
+	}
+	(void)pthread_mutex_unlock(&queue_ptr->lock);
+	return status;
+}
+
+UINT tx_queue_info_get(TX_QUEUE* queue_ptr, CHAR** name, ULONG* enqueued, ULONG* available_storage,
+                       TX_THREAD** first_suspended, ULONG* suspended_count, TX_QUEUE** next_queue) {
+	(void)name;
+	(void)first_suspended;
+	(void)suspended_count;
+	(void)next_queue;
+	(void)pthread_mutex_lock(&queue_ptr->lock);
+	if (NULL != enqueued) {
+		*enqueued = queue_ptr->enqueued;
+	}
+	if (NULL != available_storage) {
+		*available_storage = queue_ptr->capacity - queue_ptr->enqueued;
+	}
+	(void)pthread_mutex_unlock(&queue_ptr->lock);
+	return TX_SUCCESS;
+}
+
+UINT tx_mutex_create(TX_MUTEX* mutex_ptr, CHAR* name_ptr, UINT inherit) {
+	(void)name_ptr;
+	// The priorities of the threads are ignored.
+	(void)inherit;
+	mutex_ptr->ownership_count = 0;
+	(void)pthread_mutex_init(&mutex_ptr->lock, NULL);
+	init_condition(&mutex_ptr->released);
+	return TX_SUCCESS;
+}
+
+UINT tx_mutex_get(TX_MUTEX* mutex_ptr, ULONG wait_option) {
+	UINT status = TX_NOT_AVAILABLE;
+	pthread_t self = pthread_self();
+	uint64_t deadline = get_time_ticks() + wait_option;
+	(void)pthread_mutex_lock(&mutex_ptr->lock);
+	if ((0u != mutex_ptr->ownership_count) && (0 != pthread_equal(mutex_ptr->owner, self))) {
+		// The ThreadX mutexes can be taken again by their owner.
+		mutex_ptr->ownership_count++;
+		status = TX_SUCCESS;
+	} else {
+		while ((0u != mutex_ptr->ownership_count) &&
+		       wait_condition(&mutex_ptr->released, &mutex_ptr->lock, wait_option, deadline)) {
+			// Wait for the owner to release the mutex.
+		}
+		if (0u == mutex_ptr->ownership_count) {
+			mutex_ptr->owner = self;
+			mutex_ptr->ownership_count = 1;
+			status = TX_SUCCESS;
+		}
+	}
+	(void)pthread_mutex_unlock(&mutex_ptr->lock);
+	return status;
+}
+
+UINT tx_mutex_put(TX_MUTEX* mutex_ptr) {
+	UINT status = TX_NOT_OWNED;
+	(void)pthread_mutex_lock(&mutex_ptr->lock);
+	if ((0u != mutex_ptr->ownership_count) && (0 != pthread_equal(mutex_ptr->owner, pthread_self()))) {
+		mutex_ptr->ownership_count--;
+		if (0u == mutex_ptr->ownership_count) {
+			(void)pthread_cond_signal(&mutex_ptr->released);
+		}
+		status = TX_SUCCESS;
+	}
+	(void)pthread_mutex_unlock(&mutex_ptr->lock);
+	return status;
+}
+
+UINT tx_semaphore_create(TX_SEMAPHORE* semaphore_ptr, CHAR* name_ptr, ULONG initial_count) {
+	(void)name_ptr;
+	semaphore_ptr->count = initial_count;
+	(void)pthread_mutex_init(&semaphore_ptr->lock, NULL);
+	init_condition(&semaphore_ptr->put);
+	return TX_SUCCESS;
+}
+
+UINT tx_semaphore_get(TX_SEMAPHORE* semaphore_ptr, ULONG wait_option) {
+	UINT status = TX_NO_INSTANCE;
+	uint64_t deadline = get_time_ticks() + wait_option;
+	(void)pthread_mutex_lock(&semaphore_ptr->lock);
+	while ((0u == semaphore_ptr->count) &&
+	       wait_condition(&semaphore_ptr->put, &semaphore_ptr->lock, wait_option, deadline)) {
+		// Wait for the semaphore to be put.
+	}
+	if (semaphore_ptr->count > 0u) {
+		semaphore_ptr->count--;
+		status = TX_SUCCESS;
+	}
+	(void)pthread_mutex_unlock(&semaphore_ptr->lock);
+	return status;
+}
+
+UINT tx_semaphore_put(TX_SEMAPHORE* semaphore_ptr) {
+	(void)pthread_mutex_lock(&semaphore_ptr->lock);
+	semaphore_ptr->count++;
+	(void)pthread_cond_signal(&semaphore_ptr->put);
+	(void)pthread_mutex_unlock(&semaphore_ptr->lock);
+	return TX_SUCCESS;
+}
+
+UINT tx_semaphore_ceiling_put(TX_SEMAPHORE* semaphore_ptr, ULONG ceiling) {
+	UINT status = TX_CEILING_EXCEEDED;
+	(void)pthread_mutex_lock(&semaphore_ptr->lock);
+	if (semaphore_ptr->count < ceiling) {
+		semaphore_ptr->count++;
+		(void)pthread_cond_signal(&semaphore_ptr->put);
+		status = TX_SUCCESS;
+	}
+	(void)pthread_mutex_unlock(&semaphore_ptr->lock);
+	return status;
+}
+
+UINT tx_thread_create(TX_THREAD* thread_ptr, CHAR* name_ptr, VOID (*entry_function)(ULONG), ULONG entry_input,
+                      VOID* stack_start, ULONG stack_size, UINT priority, UINT preempt_threshold,
+                      ULONG time_slice, UINT auto_start) {
+	(void)name_ptr;
+	(void)stack_start;
+	(void)stack_size;
+	(void)priority;
+	(void)preempt_threshold;
+	(void)time_slice;
+	UINT status = TX_SUCCESS;
+	thread_ptr->entry = entry_function;
+	thread_ptr->input = entry_input;
+	thread_ptr->started = false;
+	// A thread created with TX_DONT_START never runs: the subset cannot resume it.
+	if (TX_AUTO_START == auto_start) {
+		thread_ptr->started = 0 == pthread_create(&thread_ptr->thread, NULL, thread_entry, thread_ptr);
+		status = thread_ptr->started ? TX_SUCCESS : TX_THREAD_ERROR;
+	}
+	return status;
+}
+
+UINT tx_thread_delete(TX_THREAD* thread_ptr) {
+	// ThreadX only deletes a completed thread: wait for the end of its entry function.
+	if (thread_ptr->started) {
+		(void)pthread_join(thread_ptr->thread, NULL);
+		thread_ptr->started = false;
+	}
+	thread_ptr->entry = NULL;
+	return TX_SUCCESS;
+}
+
+UINT tx_thread_sleep(ULONG timer_ticks) {
+	struct timespec duration = to_timespec(timer_ticks);
+	(void)nanosleep(&duration, NULL);
+	return TX_SUCCESS;
+}
+
+UINT tx_timer_create(TX_TIMER* timer_ptr, CHAR* name_ptr, VOID (*expiration_function)(ULONG), ULONG expiration_input,
+                     ULONG initial_ticks, ULONG reschedule_ticks, UINT auto_activate) {
+	(void)name_ptr;
+	UINT status = TX_TIMER_ERROR;
+	timer_ptr->expiration_function = expiration_function;
+	timer_ptr->expiration_input = expiration_input;
+	timer_ptr->initial_ticks = initial_ticks;
+	timer_ptr->reschedule_ticks = reschedule_ticks;
+	timer_ptr->active = auto_activate;
+	timer_ptr->expiration_time = get_time_ticks() + initial_ticks;
+	(void)pthread_mutex_init(&timer_ptr->lock, NULL);
+	init_condition(&timer_ptr->changed);
+	// The timers are never deleted: their threads are detached.
+	if (0 == pthread_create(&timer_ptr->thread, NULL, timer_entry, timer_ptr)) {
+		(void)pthread_detach(timer_ptr->thread);
+		status = TX_SUCCESS;
+	}
+	return status;
+}
+
+UINT tx_timer_activate(TX_TIMER* timer_ptr) {
+	UINT status = TX_ACTIVATE_ERROR;
+	(void)pthread_mutex_lock(&timer_ptr->lock);
+	if (TX_NO_ACTIVATE == timer_ptr->active) {
+		timer_ptr->active = TX_AUTO_ACTIVATE;
+		timer_ptr->expiration_time = get_time_ticks() + timer_ptr->initial_ticks;
+		(void)pthread_cond_signal(&timer_ptr->changed);
+		status = TX_SUCCESS;
+	}
+	(void)pthread_mutex_unlock(&timer_ptr->lock);
+	return status;
+}
+
+UINT tx_timer_deactivate(TX_TIMER* timer_ptr) {
+	(void)pthread_mutex_lock(&timer_ptr->lock);
+	timer_ptr->active = TX_NO_ACTIVATE;
+	(void)pthread_cond_signal(&timer_ptr->changed);
+	(void)pthread_mutex_unlock(&timer_ptr->lock);
+	return TX_SUCCESS;
+}
+
+UINT tx_timer_change(TX_TIMER* timer_ptr, ULONG initial_ticks, ULONG reschedule_ticks) {
+	UINT status = TX_ACTIVATE_ERROR;
+	(void)pthread_mutex_lock(&timer_ptr->lock);
+	if (TX_NO_ACTIVATE == timer_ptr->active) {
+		timer_ptr->initial_ticks = initial_ticks;
+		timer_ptr->reschedule_ticks = reschedule_ticks;
+		status = TX_SUCCESS;
+	}
+	(void)pthread_mutex_unlock(&timer_ptr->lock);
+	return status;
+}
+
+UINT tx_interrupt_control(UINT new_posture) {
+	UINT previous_posture = interrupt_posture;
+	if ((TX_INT_DISABLE == new_posture) && (TX_INT_ENABLE == previous_posture)) {
+		(void)pthread_mutex_lock(&interrupt_lock);
+	} else if ((TX_INT_ENABLE == new_posture) && (TX_INT_DISABLE == previous_posture)) {
+		(void)pthread_mutex_unlock(&interrupt_lock);
+	} else {
+		// The posture is unchanged.
+	}
+	interrupt_posture = new_posture;
+	return previous_posture;
+}
+
+ULONG tx_time_get(VOID) {
+	return (ULONG)get_time_ticks();
+}
+
+#ifdef __cplusplus
+}
+#endif
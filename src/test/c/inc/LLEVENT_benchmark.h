@@ -0,0 +1,131 @@
+/*
+ * C
+ *
+ * Copyright 2026 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+#ifndef  LLEVENT_BENCHMARK_H
+#define  LLEVENT_BENCHMARK_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @file
+ * @brief Benchmarks of the LLEVENT implementation: offer and wait throughput, read throughput and offer-to-wake
+ * latency. Every benchmark reports the number of cycles per operation measured with BENCHMARK_CYCLES().
+ * The macros of this file can be overridden on the command line.
+ * @author MicroEJ Developer Team
+ * @version 1.0.1
+ */
+
+#include <stdint.h>
+#include <embUnit/embUnit.h>
+
+/**
+ * Gets the current value of a 32-bit cycle counter.
+ * The default is the time stamp counter on x86 hosts, the DWT cycle counter on Cortex-M3 and higher (enabled by the
+ * benchmarks) and the ThreadX tick otherwise.
+ */
+#ifndef BENCHMARK_CYCLES
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define BENCHMARK_CYCLES() ((uint32_t)__rdtsc())
+#elif defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__) || defined(__ARM_ARCH_8M_MAIN__)
+#define BENCHMARK_DWT_CYCLE_COUNTER
+#define BENCHMARK_CYCLES() (*(volatile uint32_t*)0xE0001004u)
+#else
+#include "tx_api.h"
+#define BENCHMARK_CYCLES() ((uint32_t)tx_time_get())
+#endif
+#endif // BENCHMARK_CYCLES
+
+/**
+ * Number of cycles per second of BENCHMARK_CYCLES(), used to report the operations per second. 0 if unknown.
+ */
+#ifndef BENCHMARK_CYCLES_PER_SECOND
+#define BENCHMARK_CYCLES_PER_SECOND (0)
+#endif
+
+/**
+ * Number of operations measured by each benchmark.
+ */
+#ifndef BENCHMARK_ITERATIONS
+#define BENCHMARK_ITERATIONS (1000)
+#endif
+
+/**
+ * Max number of events offered before the queue is drained by the throughput benchmarks. Must not be greater than
+ * EVENT_QUEUE_SIZE.
+ */
+#ifndef BENCHMARK_BATCH_SIZE
+#define BENCHMARK_BATCH_SIZE (32)
+#endif
+
+/**
+ * Max data length of the extended events, in bytes.
+ */
+#ifndef BENCHMARK_MAX_DATA_LENGTH
+#define BENCHMARK_MAX_DATA_LENGTH (4096)
+#endif
+
+/**
+ * Max number of producers of the offer-to-wake latency benchmark, which runs with 1 to BENCHMARK_MAX_PRODUCERS
+ * producers.
+ */
+#ifndef BENCHMARK_MAX_PRODUCERS
+#define BENCHMARK_MAX_PRODUCERS (4)
+#endif
+
+/**
+ * Number of events offered by each producer of the offer-to-wake latency benchmark.
+ */
+#ifndef BENCHMARK_LATENCY_EVENTS
+#define BENCHMARK_LATENCY_EVENTS (100)
+#endif
+
+/**
+ * Set to 1 to run the producers of the offer-to-wake latency benchmark in ThreadX threads. Set to 0 to offer the
+ * events from the thread running the benchmarks, once the Java thread is suspended (only the offer and the wakeup
+ * paths are then measured, not the scheduling).
+ */
+#ifndef BENCHMARK_PRODUCER_THREADS
+#define BENCHMARK_PRODUCER_THREADS (1)
+#endif
+
+/**
+ * Priority of the producer threads. Should be higher than the priority of the thread running the benchmarks.
+ */
+#ifndef BENCHMARK_PRODUCER_PRIORITY
+#define BENCHMARK_PRODUCER_PRIORITY (5)
+#endif
+
+/**
+ * Stack size (in bytes) of the producer threads.
+ */
+#ifndef BENCHMARK_PRODUCER_STACK_SIZE
+#define BENCHMARK_PRODUCER_STACK_SIZE (1024)
+#endif
+
+/**
+ * Set to 1 to also print each result as a JSON object on its own line, for the tools tracking the performance
+ * regressions: {"benchmark": name, "operations": count, "cycles_per_operation": count}, with "operations_per_second"
+ * when BENCHMARK_CYCLES_PER_SECOND is known and "min_cycles" and "max_cycles" for the latency benchmarks.
+ */
+#ifndef BENCHMARK_JSON_OUTPUT
+#define BENCHMARK_JSON_OUTPUT (0)
+#endif
+
+/**
+ * Gets the embUnit test suite running the benchmarks.
+ * The suite initializes the LLEVENT implementation, it must be the first suite using it.
+ */
+TestRef LLEVENT_benchmark_tests(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // LLEVENT_BENCHMARK_H
@@ -0,0 +1,53 @@
+/*
+ * C
+ *
+ * Copyright 2026 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+#ifndef  LLEVENT_FUNCTIONAL_H
+#define  LLEVENT_FUNCTIONAL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @file
+ * @brief Functional tests of the LLEVENT implementation. The tests of an optional feature are built when it is enabled
+ * in event_configuration.h.
+ * @author MicroEJ Developer Team
+ * @version 1.0.1
+ */
+
+#include <embUnit/embUnit.h>
+#include <stdint.h>
+#include "sni.h"
+#include "event_configuration.h"
+
+/**
+ * Gets the embUnit test suite running the functional tests.
+ * The suite must run after LLEVENT_benchmark_tests(), which initializes the LLEVENT implementation. The events are
+ * offered with the lowest priority, whose queue must be dispatched by the first consumer.
+ */
+TestRef LLEVENT_functional_tests(void);
+
+#if EVENT_REPLAY_LOG_SUPPORT == 1
+
+/**
+ * Captures the replay log written by LLEVENT_REPLAY_flush(), checked by the replay log test. To build the test program
+ * with EVENT_REPLAY_LOG_SUPPORT, declare this function in event_configuration.h and define
+ * EVENT_REPLAY_LOG_WRITE(data, length) as LLEVENT_FUNCTIONAL_write_log((data), (length)).
+ *
+ * @param data the bytes of the log.
+ * @param length the number of bytes.
+ */
+void LLEVENT_FUNCTIONAL_write_log(const void* data, uint32_t length);
+
+#endif // EVENT_REPLAY_LOG_SUPPORT == 1
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // LLEVENT_FUNCTIONAL_H
@@ -0,0 +1,83 @@
+/*
+ * C
+ *
+ * Copyright 2026 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+#ifndef  SNI_STUB_H
+#define  SNI_STUB_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @file
+ * @brief SNI functions used by the LLEVENT implementation, stubbed for the test program running outside of the
+ * MicroEJ core engine. The thread running the tests plays the Java thread.
+ * @author MicroEJ Developer Team
+ * @version 1.0.1
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "sni.h"
+
+/**
+ * Initializes the stub. Must be called once before LLEVENT_IMPL_initialize().
+ */
+void SNI_STUB_initialize(void);
+
+/**
+ * Sets the length returned by SNI_getArrayLength() for the next calls.
+ *
+ * @param length the length of the arrays given to the LLEVENT functions.
+ */
+void SNI_STUB_set_array_length(int32_t length);
+
+/**
+ * Checks whether the last LLEVENT call suspended the Java thread.
+ *
+ * @return true if the Java thread is suspended, false otherwise.
+ */
+bool SNI_STUB_is_suspended(void);
+
+/**
+ * Waits until the suspended Java thread is resumed or its timeout expires, then calls the callback given to
+ * SNI_suspendCurrentJavaThreadWithCallback(), as the core engine does.
+ *
+ * @return the value returned by the callback, 0 if the Java thread is not suspended.
+ */
+int32_t SNI_STUB_resume(void);
+
+/**
+ * Same as SNI_STUB_resume() for a Java thread suspended by LLEVENT_IMPL_wait_events_with_timeout(): the callback is
+ * called with the arguments of the suspended call, as the core engine does.
+ *
+ * @param events the Java int array given to the suspended call.
+ * @param timeout the timeout given to the suspended call.
+ * @return the value returned by the callback, 0 if the Java thread is not suspended.
+ */
+int32_t SNI_STUB_resume_events(jint* events, jlong timeout);
+
+/**
+ * Waits for an event like the Java event pump: calls LLEVENT_IMPL_wait_event() and, when the Java thread is suspended,
+ * waits until it is resumed.
+ *
+ * @return the event.
+ */
+uint32_t SNI_STUB_wait_event(void);
+
+/**
+ * Gets and clears the exception thrown by the last LLEVENT calls.
+ *
+ * @return true if an exception has been thrown, false otherwise.
+ */
+bool SNI_STUB_take_exception(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SNI_STUB_H
@@ -8,12 +8,15 @@
 #include "Outputter.h"
 #include "TextUIRunner.h"
 #include "XMLOutputter.h"
+#include "LLEVENT_benchmark.h"
+#include "LLEVENT_functional.h"
 
 int main (int argc, const char* argv[])
 {
 	TextUIRunner_setOutputter(XMLOutputter_outputter());
 	TextUIRunner_start();
-	// Please add your tests here
+	TextUIRunner_runTest(LLEVENT_benchmark_tests());
+	TextUIRunner_runTest(LLEVENT_functional_tests());
 	TextUIRunner_end();
 	return 0;
 }
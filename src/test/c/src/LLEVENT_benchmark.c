@@ -0,0 +1,536 @@
+/*
+ * C
+ *
+ * Copyright 2026 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/**
+ * @file
+ * @brief Benchmarks of the LLEVENT implementation.
+ * @author MicroEJ Developer Team
+ * @version 1.0.1
+ */
+
+// -----------------------------------------------------------------------------
+// Includes
+// -----------------------------------------------------------------------------
+
+#include "LLEVENT_benchmark.h"
+#include "LLEVENT.h"
+#include "LLEVENT_impl.h"
+#include "LLEVENT_framing.h"
+#include "SNI_stub.h"
+#include "event_configuration.h"
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "tx_api.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// -----------------------------------------------------------------------------
+// Macros and Defines
+// -----------------------------------------------------------------------------
+
+// The event types used by the benchmarks, the latency benchmark uses one type per producer.
+#define SIMPLE_EVENT_TYPE       1
+#define EXTENDED_EVENT_TYPE     2
+#define LATENCY_EVENT_TYPE      3
+#define TYPED_EVENT_TYPE        4
+
+// Mask of the data of a simple event, also used to compute the latency from the cycles stored in the data.
+#define EVENT_DATA_MASK         LLEVENT_FRAMING_DATA_MASK
+
+// Number of data lengths measured for the extended events.
+#define DATA_LENGTH_COUNT       6
+
+// -----------------------------------------------------------------------------
+// Private global variables
+// -----------------------------------------------------------------------------
+
+// The data of the typed extended events.
+typedef struct {
+	int32_t values[4];
+} typed_event_t;
+
+// Defines offer_typed_event(), offering a typed_event_t without checking its arguments.
+LLEVENT_FRAMING_TYPED_OFFER(offer_typed_event, TYPED_EVENT_TYPE, typed_event_t)
+
+// The data lengths measured for the extended events, in bytes.
+static const uint32_t data_lengths[DATA_LENGTH_COUNT] = { 4, 16, 64, 256, 1024, 4096 };
+
+// The data of the extended events offered, and the buffer where they are read.
+static uint8_t offered_data[BENCHMARK_MAX_DATA_LENGTH];
+static uint8_t read_data[BENCHMARK_MAX_DATA_LENGTH];
+
+static bool initialized = false;
+
+#if BENCHMARK_PRODUCER_THREADS == 1
+static TX_THREAD producer_threads[BENCHMARK_MAX_PRODUCERS];
+static ULONG producer_stacks[BENCHMARK_MAX_PRODUCERS][BENCHMARK_PRODUCER_STACK_SIZE / sizeof(ULONG)];
+static CHAR* producer_thread_name = "Event Benchmark Producer";
+
+// Given by each producer thread when all its events have been offered.
+static TX_SEMAPHORE producers_done_semaphore;
+static CHAR* producers_done_semaphore_name = "Event Benchmark Producers";
+
+// Number of times a producer could not offer an event because the queue was full.
+static volatile uint32_t producers_full_count;
+#endif // BENCHMARK_PRODUCER_THREADS == 1
+
+// -----------------------------------------------------------------------------
+// Private function definition
+// -----------------------------------------------------------------------------
+
+/**
+ * Gets the number of operations per second of a benchmark.
+ *
+ * @return the number of operations per second, 0 if BENCHMARK_CYCLES_PER_SECOND is unknown.
+ */
+static uint32_t get_operations_per_second(uint32_t operations, uint64_t cycles) {
+	uint64_t operations_per_second = 0;
+	if ((BENCHMARK_CYCLES_PER_SECOND != 0) && (cycles > 0u)) {
+		operations_per_second = ((uint64_t)operations * (uint64_t)BENCHMARK_CYCLES_PER_SECOND) / cycles;
+	}
+	return (uint32_t)operations_per_second;
+}
+
+/**
+ * Prints the result of a benchmark.
+ *
+ * @param name the name of the benchmark.
+ * @param operations the number of operations measured.
+ * @param cycles the number of cycles of all the operations.
+ * @param json_fields the additional fields of the JSON result, each one preceded by a comma, "" if none.
+ */
+static void report_with_fields(const char* name, uint32_t operations, uint64_t cycles, const char* json_fields) {
+	uint32_t cycles_per_operation = (operations > 0u) ? (uint32_t)(cycles / operations) : 0u;
+	uint32_t operations_per_second = get_operations_per_second(operations, cycles);
+	printf("[Benchmark] %-32s %8u ops %10u cycles/op", name, (unsigned int)operations,
+	       (unsigned int)cycles_per_operation);
+	if (operations_per_second != 0u) {
+		printf(" %10u ops/s", (unsigned int)operations_per_second);
+	}
+	printf("\n");
+#if BENCHMARK_JSON_OUTPUT == 1
+	printf("{\"benchmark\": \"%s\", \"operations\": %u, \"cycles_per_operation\": %u", name, (unsigned int)operations,
+	       (unsigned int)cycles_per_operation);
+	if (operations_per_second != 0u) {
+		printf(", \"operations_per_second\": %u", (unsigned int)operations_per_second);
+	}
+	printf("%s}\n", json_fields);
+#else
+	(void)json_fields;
+#endif // BENCHMARK_JSON_OUTPUT == 1
+}
+
+/**
+ * Prints the result of a benchmark.
+ *
+ * @param name the name of the benchmark.
+ * @param operations the number of operations measured.
+ * @param cycles the number of cycles of all the operations.
+ */
+static void report(const char* name, uint32_t operations, uint64_t cycles) {
+	report_with_fields(name, operations, cycles, "");
+}
+
+/**
+ * Fills the data of the extended events with a known pattern.
+ */
+static void fill_offered_data(void) {
+	for (uint32_t i = 0; i < (uint32_t)BENCHMARK_MAX_DATA_LENGTH; i++) {
+		offered_data[i] = (uint8_t)((i * 7u) + 3u);
+	}
+}
+
+/**
+ * Waits for an event and starts to read its data if it is an extended event.
+ *
+ * @return the event.
+ */
+static uint32_t start_extended_event(void) {
+	uint32_t event = SNI_STUB_wait_event();
+	if (LLEVENT_FRAMING_is_extended(event)) {
+		LLEVENT_IMPL_start_read_extended_data(LLEVENT_FRAMING_get_data(event));
+	}
+	return event;
+}
+
+/**
+ * Offers an extended event into the empty queue to check that its data fits in the payload buffer.
+ *
+ * @return true if the extended event can be offered, false if it is too large: it is then reported as skipped.
+ */
+static bool check_data_length(const char* benchmark, uint32_t data_length) {
+	bool fits = LLEVENT_offerExtendedEvent(EXTENDED_EVENT_TYPE, offered_data, (int32_t)data_length) == NO_ERR;
+	if (fits) {
+		(void)start_extended_event();
+		LLEVENT_IMPL_end_read_extended_data();
+	} else {
+		printf("[Benchmark] %s(%u) skipped: the data does not fit in the payload buffer\n", benchmark,
+		       (unsigned int)data_length);
+	}
+	return fits;
+}
+
+/**
+ * Gets the number of extended events of a data length offered by each batch of the throughput benchmarks: at most
+ * BENCHMARK_BATCH_SIZE, as many as fit in the empty payload buffer, so that the measured offers do not fail.
+ *
+ * @return the number of events of a batch.
+ */
+static uint32_t get_extended_batch_size(uint32_t data_length) {
+	uint32_t batch_size = 0;
+	while ((batch_size < (uint32_t)BENCHMARK_BATCH_SIZE) &&
+	       (LLEVENT_offerExtendedEvent(EXTENDED_EVENT_TYPE, offered_data, (int32_t)data_length) == NO_ERR)) {
+		batch_size++;
+	}
+	for (uint32_t i = 0; i < batch_size; i++) {
+		(void)start_extended_event();
+		LLEVENT_IMPL_end_read_extended_data();
+	}
+	return batch_size;
+}
+
+#ifdef BENCHMARK_DWT_CYCLE_COUNTER
+/**
+ * Enables the DWT cycle counter.
+ */
+static void enable_cycle_counter(void) {
+	// Set TRCENA in DEMCR, then CYCCNTENA in DWT_CTRL.
+	*(volatile uint32_t*)0xE000EDFCu |= (uint32_t)1 << 24;
+	*(volatile uint32_t*)0xE0001004u = 0;
+	*(volatile uint32_t*)0xE0001000u |= 1u;
+}
+#endif // BENCHMARK_DWT_CYCLE_COUNTER
+
+#if BENCHMARK_PRODUCER_THREADS == 1
+
+/**
+ * Entry point of a producer thread of the latency benchmark: offers events holding the cycle counter at the time of
+ * the offer.
+ *
+ * @param input the index of the producer.
+ */
+static VOID producer_entry(ULONG input) {
+	for (uint32_t i = 0; i < (uint32_t)BENCHMARK_LATENCY_EVENTS; i++) {
+		// Let the Java thread wait for the next event.
+		(void)tx_thread_sleep(1);
+		uint32_t data = BENCHMARK_CYCLES() & EVENT_DATA_MASK;
+		while (LLEVENT_offerEvent((int32_t)(LATENCY_EVENT_TYPE + input), (int32_t)data) != NO_ERR) {
+			// Queue full: retry later, the latency of this event then includes the wait.
+			producers_full_count++;
+			(void)tx_thread_sleep(1);
+		}
+	}
+	(void)tx_semaphore_put(&producers_done_semaphore);
+}
+
+#endif // BENCHMARK_PRODUCER_THREADS == 1
+
+/**
+ * Measures the offer-to-wake latency with a number of producers.
+ *
+ * @param producers the number of producers.
+ */
+static void benchmark_latency(uint32_t producers) {
+	uint64_t total_latency = 0;
+	uint32_t min_latency = EVENT_DATA_MASK;
+	uint32_t max_latency = 0;
+	uint32_t events = producers * (uint32_t)BENCHMARK_LATENCY_EVENTS;
+
+#if BENCHMARK_PRODUCER_THREADS == 1
+	producers_full_count = 0;
+	for (uint32_t p = 0; p < producers; p++) {
+		UINT status = tx_thread_create(&producer_threads[p], producer_thread_name, producer_entry, p,
+		                               &producer_stacks[p][0], sizeof(producer_stacks[p]), BENCHMARK_PRODUCER_PRIORITY,
+		                               BENCHMARK_PRODUCER_PRIORITY, TX_NO_TIME_SLICE, TX_AUTO_START);
+		TEST_ASSERT_EQUAL_INT(TX_SUCCESS, status);
+	}
+#endif // BENCHMARK_PRODUCER_THREADS == 1
+
+	uint32_t received = 0;
+	while (received < events) {
+#if BENCHMARK_PRODUCER_THREADS == 1
+		uint32_t event = SNI_STUB_wait_event();
+#else
+		uint32_t event = LLEVENT_IMPL_wait_event();
+		if (SNI_STUB_is_suspended()) {
+			// The queue is empty and the Java thread is waiting: each producer offers an event.
+			for (uint32_t p = 0; p < producers; p++) {
+				uint32_t data = BENCHMARK_CYCLES() & EVENT_DATA_MASK;
+				TEST_ASSERT_EQUAL_INT(NO_ERR, LLEVENT_offerEvent((int32_t)(LATENCY_EVENT_TYPE + p), (int32_t)data));
+			}
+			event = (uint32_t)SNI_STUB_resume();
+		}
+#endif // BENCHMARK_PRODUCER_THREADS == 1
+		uint32_t latency = (BENCHMARK_CYCLES() - event) & EVENT_DATA_MASK;
+		TEST_ASSERT(((event >> 24) - (uint32_t)LATENCY_EVENT_TYPE) < producers);
+		total_latency += latency;
+		min_latency = (latency < min_latency) ? latency : min_latency;
+		max_latency = (latency > max_latency) ? latency : max_latency;
+		received++;
+	}
+
+#if BENCHMARK_PRODUCER_THREADS == 1
+	for (uint32_t p = 0; p < producers; p++) {
+		TEST_ASSERT_EQUAL_INT(TX_SUCCESS, tx_semaphore_get(&producers_done_semaphore, TX_WAIT_FOREVER));
+	}
+	for (uint32_t p = 0; p < producers; p++) {
+		TEST_ASSERT_EQUAL_INT(TX_SUCCESS, tx_thread_delete(&producer_threads[p]));
+	}
+#endif // BENCHMARK_PRODUCER_THREADS == 1
+
+	char name[40];
+	char json_fields[64];
+	(void)snprintf(name, sizeof(name), "wake latency, %u producer(s)", (unsigned int)producers);
+	(void)snprintf(json_fields, sizeof(json_fields), ", \"min_cycles\": %u, \"max_cycles\": %u",
+	               (unsigned int)min_latency, (unsigned int)max_latency);
+	report_with_fields(name, received, total_latency, json_fields);
+	printf("[Benchmark] %-32s min %u, max %u cycles/op\n", "", (unsigned int)min_latency, (unsigned int)max_latency);
+#if BENCHMARK_PRODUCER_THREADS == 1
+	if (producers_full_count != 0u) {
+		printf("[Benchmark] %-32s %u offers retried, queue full\n", "", (unsigned int)producers_full_count);
+	}
+#endif // BENCHMARK_PRODUCER_THREADS == 1
+}
+
+// -----------------------------------------------------------------------------
+// Benchmarks
+// -----------------------------------------------------------------------------
+
+static void setUp(void) {
+	if (!initialized) {
+#ifdef BENCHMARK_DWT_CYCLE_COUNTER
+		enable_cycle_counter();
+#endif // BENCHMARK_DWT_CYCLE_COUNTER
+		SNI_STUB_initialize();
+		LLEVENT_IMPL_initialize();
+#if BENCHMARK_PRODUCER_THREADS == 1
+		(void)tx_semaphore_create(&producers_done_semaphore, producers_done_semaphore_name, 0);
+#endif // BENCHMARK_PRODUCER_THREADS == 1
+		fill_offered_data();
+		initialized = true;
+	}
+	SNI_STUB_set_array_length(BENCHMARK_MAX_DATA_LENGTH);
+	(void)SNI_STUB_take_exception();
+}
+
+static void tearDown(void) {
+	TEST_ASSERT(!SNI_STUB_take_exception());
+}
+
+/**
+ * Offers batches of simple events, then waits for them.
+ */
+static void benchmark_simple_events(void) {
+	uint64_t offer_cycles = 0;
+	uint64_t wait_cycles = 0;
+	uint32_t operations = 0;
+
+	while (operations < (uint32_t)BENCHMARK_ITERATIONS) {
+		uint32_t start = BENCHMARK_CYCLES();
+		for (uint32_t i = 0; i < (uint32_t)BENCHMARK_BATCH_SIZE; i++) {
+			(void)LLEVENT_offerEvent(SIMPLE_EVENT_TYPE, (int32_t)i);
+		}
+		uint32_t middle = BENCHMARK_CYCLES();
+		for (uint32_t i = 0; i < (uint32_t)BENCHMARK_BATCH_SIZE; i++) {
+			uint32_t event = SNI_STUB_wait_event();
+			TEST_ASSERT_EQUAL_INT(LLEVENT_FRAMING_simple_event(SIMPLE_EVENT_TYPE, i), event);
+		}
+		uint32_t end = BENCHMARK_CYCLES();
+		offer_cycles += middle - start;
+		wait_cycles += end - middle;
+		operations += (uint32_t)BENCHMARK_BATCH_SIZE;
+	}
+
+	report("offer simple event", operations, offer_cycles);
+	report("wait simple event", operations, wait_cycles);
+}
+
+/**
+ * Offers batches of extended events of several data lengths, then waits for them without reading their data. The
+ * batches are not larger than the payload buffer, so that only successful offers are measured.
+ */
+static void benchmark_extended_events(void) {
+	for (uint32_t l = 0; l < (uint32_t)DATA_LENGTH_COUNT; l++) {
+		uint32_t data_length = data_lengths[l];
+		if ((data_length <= (uint32_t)BENCHMARK_MAX_DATA_LENGTH) && check_data_length("extended event", data_length)) {
+			uint32_t batch_size = get_extended_batch_size(data_length);
+			uint64_t offer_cycles = 0;
+			uint64_t wait_cycles = 0;
+			uint32_t operations = 0;
+
+			while (operations < (uint32_t)BENCHMARK_ITERATIONS) {
+				uint32_t batch = 0;
+				uint32_t start = BENCHMARK_CYCLES();
+				for (uint32_t i = 0; i < batch_size; i++) {
+					if (LLEVENT_offerExtendedEvent(EXTENDED_EVENT_TYPE, offered_data, (int32_t)data_length) == NO_ERR) {
+						batch++;
+					}
+				}
+				uint32_t middle = BENCHMARK_CYCLES();
+				TEST_ASSERT_EQUAL_INT(batch_size, batch);
+				for (uint32_t i = 0; i < batch; i++) {
+					TEST_ASSERT_EQUAL_INT(LLEVENT_FRAMING_extended_event(EXTENDED_EVENT_TYPE, data_length),
+					                      start_extended_event());
+					LLEVENT_IMPL_end_read_extended_data();
+				}
+				uint32_t end = BENCHMARK_CYCLES();
+				offer_cycles += middle - start;
+				wait_cycles += end - middle;
+				operations += batch;
+			}
+
+			char name[40];
+			(void)snprintf(name, sizeof(name), "offer extended event(%u)", (unsigned int)data_length);
+			report(name, operations, offer_cycles);
+			(void)snprintf(name, sizeof(name), "wait extended event(%u)", (unsigned int)data_length);
+			report(name, operations, wait_cycles);
+		}
+	}
+}
+
+/**
+ * Offers batches of extended events of a fixed C type with the function defined by LLEVENT_FRAMING_TYPED_OFFER()
+ * and with LLEVENT_offerExtendedEvent(), then waits for them without reading their data.
+ */
+static void benchmark_typed_events(void) {
+	typed_event_t value = { { 1, 2, 3, 4 } };
+	uint64_t typed_cycles = 0;
+	uint64_t checked_cycles = 0;
+	uint32_t operations = 0;
+
+	while (operations < (uint32_t)BENCHMARK_ITERATIONS) {
+		uint32_t batch = 0;
+		uint32_t start = BENCHMARK_CYCLES();
+		while ((batch < (uint32_t)BENCHMARK_BATCH_SIZE) && (offer_typed_event(&value) == NO_ERR)) {
+			batch++;
+		}
+		uint32_t middle = BENCHMARK_CYCLES();
+		for (uint32_t i = 0; i < batch; i++) {
+			TEST_ASSERT_EQUAL_INT(LLEVENT_FRAMING_extended_event(TYPED_EVENT_TYPE, sizeof(value)), start_extended_event());
+			LLEVENT_IMPL_end_read_extended_data();
+		}
+		uint32_t checked_batch = 0;
+		uint32_t checked_start = BENCHMARK_CYCLES();
+		while ((checked_batch < batch) &&
+		       (LLEVENT_offerExtendedEvent(TYPED_EVENT_TYPE, &value, (int32_t)sizeof(value)) == NO_ERR)) {
+			checked_batch++;
+		}
+		uint32_t checked_end = BENCHMARK_CYCLES();
+		for (uint32_t i = 0; i < checked_batch; i++) {
+			TEST_ASSERT(LLEVENT_FRAMING_is_extended(start_extended_event()));
+			LLEVENT_IMPL_end_read_extended_data();
+		}
+		TEST_ASSERT(batch > 0u);
+		typed_cycles += middle - start;
+		checked_cycles += checked_end - checked_start;
+		operations += batch;
+	}
+
+	report("offer typed event(16)", operations, typed_cycles);
+	report("offer checked event(16)", operations, checked_cycles);
+}
+
+/**
+ * Reads the data of extended events of several data lengths with LLEVENT_IMPL_read() and the typed readers.
+ * An operation reads the whole data of an event.
+ */
+static void benchmark_read(void) {
+	for (uint32_t l = 0; l < (uint32_t)DATA_LENGTH_COUNT; l++) {
+		uint32_t data_length = data_lengths[l];
+		if ((data_length <= (uint32_t)BENCHMARK_MAX_DATA_LENGTH) && check_data_length("read", data_length)) {
+			// The readers: LLEVENT_IMPL_read(), read_byte(), read_short(), read_int(), read_long(), skip_bytes().
+			const char* reader_names[] = { "read", "read_byte", "read_short", "read_int", "read_long", "skip_bytes" };
+			for (uint32_t r = 0; r < (sizeof(reader_names) / sizeof(reader_names[0])); r++) {
+				uint64_t read_cycles = 0;
+				uint32_t operations = (uint32_t)BENCHMARK_ITERATIONS / 10u;
+				for (uint32_t i = 0; i < operations; i++) {
+					TEST_ASSERT_EQUAL_INT(NO_ERR, LLEVENT_offerExtendedEvent(EXTENDED_EVENT_TYPE, offered_data,
+					                                                         (int32_t)data_length));
+					TEST_ASSERT(LLEVENT_FRAMING_is_extended(start_extended_event()));
+					(void)memset(read_data, 0, data_length);
+					uint32_t start = BENCHMARK_CYCLES();
+					switch (r) {
+					case 0:
+						TEST_ASSERT_EQUAL_INT(data_length, LLEVENT_IMPL_read(read_data, 0, data_length));
+						break;
+					case 1:
+						for (uint32_t j = 0; j < data_length; j++) {
+							read_data[j] = (uint8_t)LLEVENT_IMPL_read_byte();
+						}
+						break;
+					case 2:
+						for (uint32_t j = 0; j < data_length; j += (uint32_t)sizeof(jshort)) {
+							jshort value = LLEVENT_IMPL_read_short();
+							(void)memcpy(&read_data[j], &value, sizeof(value));
+						}
+						break;
+					case 3:
+						for (uint32_t j = 0; j < data_length; j += (uint32_t)sizeof(jint)) {
+							jint value = LLEVENT_IMPL_read_int();
+							(void)memcpy(&read_data[j], &value, sizeof(value));
+						}
+						break;
+					case 4:
+						for (uint32_t j = 0; (j + (uint32_t)sizeof(jlong)) <= data_length; j += (uint32_t)sizeof(jlong)) {
+							jlong value = LLEVENT_IMPL_read_long();
+							(void)memcpy(&read_data[j], &value, sizeof(value));
+						}
+						break;
+					default:
+						TEST_ASSERT_EQUAL_INT(EVENT_OK, LLEVENT_IMPL_skip_bytes(data_length));
+						break;
+					}
+					read_cycles += BENCHMARK_CYCLES() - start;
+					LLEVENT_IMPL_end_read_extended_data();
+
+					// The short and int readers swap the bytes on big-endian targets, check the other readers only.
+					if ((r == 0u) || (r == 1u)) {
+						TEST_ASSERT(memcmp(offered_data, read_data, data_length) == 0);
+					}
+				}
+
+				char name[40];
+				(void)snprintf(name, sizeof(name), "%s(%u)", reader_names[r], (unsigned int)data_length);
+				report(name, operations, read_cycles);
+			}
+		}
+	}
+}
+
+/**
+ * Measures the offer-to-wake latency with 1 to BENCHMARK_MAX_PRODUCERS producers: the time between the offer of an
+ * event and its reception by the Java thread waiting for it.
+ */
+static void benchmark_wake_latency(void) {
+	for (uint32_t producers = 1; producers <= (uint32_t)BENCHMARK_MAX_PRODUCERS; producers++) {
+		benchmark_latency(producers);
+	}
+}
+
+// -----------------------------------------------------------------------------
+// Public function definition
+// -----------------------------------------------------------------------------
+
+TestRef LLEVENT_benchmark_tests(void) {
+	EMB_UNIT_TESTFIXTURES(fixtures) {
+		new_TestFixture("benchmark_simple_events", benchmark_simple_events),
+		new_TestFixture("benchmark_extended_events", benchmark_extended_events),
+		new_TestFixture("benchmark_typed_events", benchmark_typed_events),
+		new_TestFixture("benchmark_read", benchmark_read),
+		new_TestFixture("benchmark_wake_latency", benchmark_wake_latency),
+	};
+	EMB_UNIT_TESTCALLER(benchmarks, "LLEVENT_benchmark", setUp, tearDown, fixtures);
+	return (TestRef)&benchmarks;
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,1110 @@
+/*
+ * C
+ *
+ * Copyright 2026 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/**
+ * @file
+ * @brief Functional tests of the LLEVENT implementation.
+ * @author MicroEJ Developer Team
+ * @version 1.0.1
+ */
+
+// -----------------------------------------------------------------------------
+// Includes
+// -----------------------------------------------------------------------------
+
+#include "LLEVENT_functional.h"
+#include "LLEVENT.h"
+#include "LLEVENT_amp.h"
+#include "LLEVENT_impl.h"
+#include "LLEVENT_framing.h"
+#include "LLEVENT_replay.h"
+#include "LLEVENT_threadx.h"
+#include "SNI_stub.h"
+#include "event_configuration.h"
+#include <stdbool.h>
+#include <string.h>
+
+#include "tx_api.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// -----------------------------------------------------------------------------
+// Macros and Defines
+// -----------------------------------------------------------------------------
+
+// The event types used by the tests, distinct from the types of the benchmarks.
+#define SIMPLE_EVENT_TYPE       20
+#define EXTENDED_EVENT_TYPE     21
+#define COALESCED_EVENT_TYPE    22
+#define FILTERED_EVENT_TYPE     23
+#define SPILLED_EVENT_TYPE      24
+#define DROPPED_EVENT_TYPE      25
+#define DELTA_EVENT_TYPE        26
+// The consumers test uses one type per consumer.
+#define CONSUMER_EVENT_TYPE     27
+
+// Max number of events taken at once from the queues, more than a full queue.
+#define MAX_EVENTS              1024
+
+// Number of simple events held by the overflow ring, 2 words each.
+#define RING_SIMPLE_EVENTS      (LLEVENT_AMP_RING_WORDS / 2u)
+
+// Number of bytes of data of the extended events offered.
+#define DATA_LENGTH             64
+
+// Number of bytes of the buffers of the extended data, that also hold the largest event of the AMP ring.
+#if (EVENT_AMP_BRIDGE_SUPPORT == 1) && (LLEVENT_AMP_MAX_DATA_LENGTH > DATA_LENGTH)
+#define DATA_BUFFER_SIZE        LLEVENT_AMP_MAX_DATA_LENGTH
+#else
+#define DATA_BUFFER_SIZE        DATA_LENGTH
+#endif // (EVENT_AMP_BRIDGE_SUPPORT == 1) && (LLEVENT_AMP_MAX_DATA_LENGTH > DATA_LENGTH)
+
+#if EVENT_REPLAY_LOG_SUPPORT == 1
+// Number of bytes of a record of a simple event in the replay log: its first word and its timestamp.
+#define SIMPLE_RECORD_LENGTH    8u
+
+// Number of records of simple events held by the ring of the replay log, one word of the ring is never written.
+#define RING_SIMPLE_RECORDS     (((uint32_t)EVENT_REPLAY_LOG_SIZE / SIMPLE_RECORD_LENGTH) - 1u)
+#endif // EVENT_REPLAY_LOG_SUPPORT == 1
+
+#if EVENT_COALESCING_SUPPORT == 1
+// Number of producer threads of the concurrent coalescing test, and number of events offered by each of them.
+#define PRODUCER_COUNT          2
+#define PRODUCER_OFFERS         200000
+
+// The data of the events offered by a producer thread: the index of the producer in the high bits, the index of the
+// event in the low bits.
+#define PRODUCER_DATA_SHIFT     20
+#define PRODUCER_OFFER_MASK     (((uint32_t)1u << PRODUCER_DATA_SHIFT) - 1u)
+
+// Value of last_accepted_data when a producer thread had no event accepted.
+#define NO_ACCEPTED_DATA        0xFFFFFFFFu
+
+// Priority and stack size (in bytes) of the producer threads. The priority should be higher than the priority of the
+// thread running the tests.
+#define PRODUCER_PRIORITY       5
+#define PRODUCER_STACK_SIZE     1024
+#endif // EVENT_COALESCING_SUPPORT == 1
+
+// -----------------------------------------------------------------------------
+// Private global variables
+// -----------------------------------------------------------------------------
+
+// The values of the typed reads test, laid out on their natural alignment.
+typedef struct {
+	int8_t byte_value;
+	int8_t padding;
+	int16_t short_value;
+	int32_t int_value;
+	int64_t long_value;
+} typed_values_t;
+
+// The events taken from the queues.
+static jint taken_events[MAX_EVENTS];
+
+// The data of the extended events offered, and the buffer where they are read.
+static uint8_t offered_data[DATA_BUFFER_SIZE];
+static uint8_t read_data[DATA_BUFFER_SIZE];
+
+#if EVENT_COALESCING_SUPPORT == 1
+static TX_THREAD producer_threads[PRODUCER_COUNT];
+static ULONG producer_stacks[PRODUCER_COUNT][PRODUCER_STACK_SIZE / sizeof(ULONG)];
+static CHAR* producer_thread_name = "Event Test Producer";
+
+// Given by each producer thread when all its events have been offered.
+static TX_SEMAPHORE producers_done_semaphore;
+static CHAR* producers_done_semaphore_name = "Event Test Producers";
+static bool producers_done_semaphore_created = false;
+
+// The data of the last event accepted from each producer thread, NO_ACCEPTED_DATA if none.
+static volatile uint32_t last_accepted_data[PRODUCER_COUNT];
+#endif // EVENT_COALESCING_SUPPORT == 1
+
+#if EVENT_CONSUMER_COUNT > 1
+// The consumer of the queue of each priority.
+static const uint8_t queue_consumers[EVENT_QUEUE_COUNT] = EVENT_QUEUE_CONSUMERS;
+#endif // EVENT_CONSUMER_COUNT > 1
+
+#if EVENT_AMP_BRIDGE_SUPPORT == 1
+// The ring of the events produced by the other core, played by the thread running the tests.
+static LLEVENT_amp_ring_t amp_ring;
+#endif // EVENT_AMP_BRIDGE_SUPPORT == 1
+
+#if EVENT_REPLAY_LOG_SUPPORT == 1
+// The replay log captured by LLEVENT_FUNCTIONAL_write_log(), and its length. The length also counts the bytes that
+// did not fit in the buffer.
+static uint8_t captured_log[EVENT_REPLAY_LOG_SIZE];
+static uint32_t captured_log_length;
+#endif // EVENT_REPLAY_LOG_SUPPORT == 1
+
+// -----------------------------------------------------------------------------
+// Private function definition
+// -----------------------------------------------------------------------------
+
+/**
+ * Takes the next event of the first consumer, without waiting.
+ *
+ * @param event the destination of the event.
+ * @return true if an event has been taken, false if the queues are empty.
+ */
+static bool take_event(uint32_t* event) {
+	SNI_STUB_set_array_length(1);
+	bool taken = LLEVENT_IMPL_wait_events_with_timeout(taken_events, -1) == 1;
+	// The length of the arrays given to LLEVENT_IMPL_read() and to the next waits.
+	SNI_STUB_set_array_length(MAX_EVENTS);
+	*event = (uint32_t)taken_events[0];
+	return taken;
+}
+
+/**
+ * Offers simple events of a type with the data 0, 1, 2... until the queue is full.
+ *
+ * @return the number of events offered.
+ */
+static uint32_t fill_queue(uint32_t type) {
+	uint32_t count = 0;
+	while ((count < (uint32_t)MAX_EVENTS) && (LLEVENT_offerEvent((int32_t)type, (int32_t)count) == NO_ERR)) {
+		count++;
+	}
+	return count;
+}
+
+/**
+ * Checks that the queues are empty.
+ */
+static void check_no_event(void) {
+	uint32_t event;
+	TEST_ASSERT(!take_event(&event));
+}
+
+/**
+ * Checks that the next events are simple events of a type, with consecutive data.
+ *
+ * @param type the type of the events.
+ * @param first_data the data of the first event.
+ * @param count the number of events.
+ */
+static void check_simple_events(uint32_t type, uint32_t first_data, uint32_t count) {
+	for (uint32_t i = 0; i < count; i++) {
+		uint32_t event;
+		TEST_ASSERT(take_event(&event));
+		TEST_ASSERT_EQUAL_INT(LLEVENT_FRAMING_simple_event(type, first_data + i), event);
+	}
+}
+
+/**
+ * Checks that the next event is an extended event of a type, and reads its data with LLEVENT_IMPL_read().
+ *
+ * @param type the type of the event.
+ * @param data the expected data.
+ * @param data_length the number of bytes of data.
+ */
+static void check_extended_event(uint32_t type, const uint8_t* data, uint32_t data_length) {
+	uint32_t event;
+	TEST_ASSERT(take_event(&event));
+	TEST_ASSERT_EQUAL_INT(LLEVENT_FRAMING_extended_event(type, data_length), event);
+	LLEVENT_IMPL_start_read_extended_data(data_length);
+	(void)memset(read_data, 0, sizeof(read_data));
+	TEST_ASSERT_EQUAL_INT(data_length, LLEVENT_IMPL_read(read_data, 0, data_length));
+	TEST_ASSERT_EQUAL_INT(0, LLEVENT_IMPL_available());
+	LLEVENT_IMPL_end_read_extended_data();
+	TEST_ASSERT(memcmp(data, read_data, data_length) == 0);
+}
+
+#if EVENT_COALESCING_SUPPORT == 1
+
+/**
+ * Entry point of a producer thread of the concurrent coalescing test: offers events of the coalesced type and records
+ * the last one accepted.
+ *
+ * @param input the index of the producer.
+ */
+static VOID coalescing_producer_entry(ULONG input) {
+	uint32_t last_data = NO_ACCEPTED_DATA;
+	for (uint32_t i = 0; i < (uint32_t)PRODUCER_OFFERS; i++) {
+		uint32_t data = ((uint32_t)input << PRODUCER_DATA_SHIFT) | i;
+		if (LLEVENT_offerEvent(COALESCED_EVENT_TYPE, (int32_t)data) == NO_ERR) {
+			last_data = data;
+		}
+	}
+	last_accepted_data[input] = last_data;
+	(void)tx_semaphore_put(&producers_done_semaphore);
+}
+
+/**
+ * Starts the producer threads of the concurrent coalescing test.
+ */
+static void start_producers(void) {
+	if (!producers_done_semaphore_created) {
+		UINT status = tx_semaphore_create(&producers_done_semaphore, producers_done_semaphore_name, 0);
+		TEST_ASSERT_EQUAL_INT(TX_SUCCESS, status);
+		producers_done_semaphore_created = true;
+	}
+	for (uint32_t p = 0; p < (uint32_t)PRODUCER_COUNT; p++) {
+		last_accepted_data[p] = NO_ACCEPTED_DATA;
+		UINT status = tx_thread_create(&producer_threads[p], producer_thread_name, coalescing_producer_entry, p,
+		                               &producer_stacks[p][0], sizeof(producer_stacks[p]), PRODUCER_PRIORITY,
+		                               PRODUCER_PRIORITY, TX_NO_TIME_SLICE, TX_AUTO_START);
+		TEST_ASSERT_EQUAL_INT(TX_SUCCESS, status);
+	}
+}
+
+/**
+ * Deletes the producer threads of the concurrent coalescing test, once they have all given producers_done_semaphore.
+ */
+static void delete_producers(void) {
+	for (uint32_t p = 0; p < (uint32_t)PRODUCER_COUNT; p++) {
+		TEST_ASSERT_EQUAL_INT(TX_SUCCESS, tx_thread_delete(&producer_threads[p]));
+	}
+}
+
+#endif // EVENT_COALESCING_SUPPORT == 1
+
+/**
+ * Fills the data of the extended events with a known pattern.
+ */
+static void fill_offered_data(void) {
+	for (uint32_t i = 0; i < (uint32_t)DATA_BUFFER_SIZE; i++) {
+		offered_data[i] = (uint8_t)((i * 5u) + 1u);
+	}
+}
+
+// -----------------------------------------------------------------------------
+// Tests
+// -----------------------------------------------------------------------------
+
+static void setUp(void) {
+	SNI_STUB_set_array_length(MAX_EVENTS);
+	fill_offered_data();
+	(void)SNI_STUB_take_exception();
+}
+
+static void tearDown(void) {
+	check_no_event();
+	TEST_ASSERT(!SNI_STUB_take_exception());
+}
+
+/**
+ * Offers simple and extended events, and checks their order and their data. The invalid arguments and the events
+ * offered while the queue is full are rejected.
+ */
+static void test_events(void) {
+	TEST_ASSERT_EQUAL_INT(ERR_WRONG_ARGS, LLEVENT_offerEvent(-1, 0));
+	TEST_ASSERT_EQUAL_INT(ERR_WRONG_ARGS, LLEVENT_offerEvent((int32_t)LLEVENT_FRAMING_MAX_TYPE_ID, 0));
+	TEST_ASSERT_EQUAL_INT(ERR_WRONG_ARGS,
+	                      LLEVENT_offerEvent(SIMPLE_EVENT_TYPE, (int32_t)(LLEVENT_FRAMING_DATA_MASK + 1u)));
+	check_no_event();
+
+	TEST_ASSERT_EQUAL_INT(NO_ERR, LLEVENT_offerEvent(SIMPLE_EVENT_TYPE, 0));
+	TEST_ASSERT_EQUAL_INT(NO_ERR, LLEVENT_offerExtendedEvent(EXTENDED_EVENT_TYPE, offered_data, 13));
+	TEST_ASSERT_EQUAL_INT(NO_ERR, LLEVENT_offerEvent(SIMPLE_EVENT_TYPE, 1));
+	TEST_ASSERT_EQUAL_INT(NO_ERR, LLEVENT_offerExtendedEvent(EXTENDED_EVENT_TYPE, offered_data, 0));
+	TEST_ASSERT_EQUAL_INT(NO_ERR, LLEVENT_offerEvent(SIMPLE_EVENT_TYPE, (int32_t)LLEVENT_FRAMING_DATA_MASK));
+
+	check_simple_events(SIMPLE_EVENT_TYPE, 0, 1);
+	check_extended_event(EXTENDED_EVENT_TYPE, offered_data, 13);
+	check_simple_events(SIMPLE_EVENT_TYPE, 1, 1);
+	check_extended_event(EXTENDED_EVENT_TYPE, offered_data, 0);
+	check_simple_events(SIMPLE_EVENT_TYPE, LLEVENT_FRAMING_DATA_MASK, 1);
+
+	// The event offered while the queue is full is rejected, the queued events are dispatched.
+	uint32_t count = fill_queue(SIMPLE_EVENT_TYPE);
+	TEST_ASSERT(count > 0u);
+	TEST_ASSERT_EQUAL_INT(ERR_FIFO_FULL, LLEVENT_offerEvent(SIMPLE_EVENT_TYPE, 0));
+	TEST_ASSERT_EQUAL_INT(ERR_FIFO_FULL, LLEVENT_offerExtendedEvent(EXTENDED_EVENT_TYPE, offered_data, 5));
+	check_simple_events(SIMPLE_EVENT_TYPE, 0, count);
+}
+
+/**
+ * Reads the values of an extended event with the typed readers, from the staging buffer when its data fits in it
+ * (EVENT_READ_STAGING_BUFFER_SIZE), and skips and reads the data of a second event in parts.
+ */
+static void test_typed_reads(void) {
+	typed_values_t values = { -5, 0, -1234, 0x12345678, 0x0123456789ABCDEFLL };
+	TEST_ASSERT_EQUAL_INT(NO_ERR, LLEVENT_offerExtendedEvent(EXTENDED_EVENT_TYPE, &values, (int32_t)sizeof(values)));
+	TEST_ASSERT_EQUAL_INT(NO_ERR, LLEVENT_offerExtendedEvent(EXTENDED_EVENT_TYPE, offered_data, 23));
+
+	uint32_t event;
+	TEST_ASSERT(take_event(&event));
+	TEST_ASSERT_EQUAL_INT(LLEVENT_FRAMING_extended_event(EXTENDED_EVENT_TYPE, sizeof(values)), event);
+	LLEVENT_IMPL_start_read_extended_data(sizeof(values));
+	TEST_ASSERT_EQUAL_INT(values.byte_value, LLEVENT_IMPL_read_byte());
+	// The short is aligned on 2 bytes: the padding byte is skipped.
+	TEST_ASSERT(values.short_value == LLEVENT_IMPL_read_short());
+	TEST_ASSERT(values.int_value == LLEVENT_IMPL_read_int());
+	TEST_ASSERT(values.long_value == LLEVENT_IMPL_read_long());
+	TEST_ASSERT_EQUAL_INT(0, LLEVENT_IMPL_available());
+	TEST_ASSERT(!SNI_STUB_take_exception());
+	// Reading past the end of the data throws an exception.
+	(void)LLEVENT_IMPL_read_byte();
+	TEST_ASSERT(SNI_STUB_take_exception());
+	LLEVENT_IMPL_end_read_extended_data();
+
+	TEST_ASSERT(take_event(&event));
+	TEST_ASSERT_EQUAL_INT(LLEVENT_FRAMING_extended_event(EXTENDED_EVENT_TYPE, 23), event);
+	LLEVENT_IMPL_start_read_extended_data(23);
+	(void)memset(read_data, 0, sizeof(read_data));
+	TEST_ASSERT_EQUAL_INT(3, LLEVENT_IMPL_read(read_data, 0, 3));
+	TEST_ASSERT_EQUAL_INT(EVENT_OK, LLEVENT_IMPL_skip_bytes(6));
+	TEST_ASSERT_EQUAL_INT(14, LLEVENT_IMPL_available());
+	TEST_ASSERT_EQUAL_INT(14, LLEVENT_IMPL_read(read_data, 9, 14));
+	LLEVENT_IMPL_end_read_extended_data();
+	TEST_ASSERT(memcmp(&offered_data[0], &read_data[0], 3) == 0);
+	TEST_ASSERT(memcmp(&offered_data[9], &read_data[9], 14) == 0);
+
+	// The unread data of an extended event is released by LLEVENT_IMPL_end_read_extended_data().
+	TEST_ASSERT_EQUAL_INT(NO_ERR, LLEVENT_offerExtendedEvent(EXTENDED_EVENT_TYPE, offered_data, DATA_LENGTH));
+	TEST_ASSERT_EQUAL_INT(NO_ERR, LLEVENT_offerEvent(SIMPLE_EVENT_TYPE, 7));
+	TEST_ASSERT(take_event(&event));
+	LLEVENT_IMPL_start_read_extended_data(DATA_LENGTH);
+	TEST_ASSERT_EQUAL_INT(offered_data[0], LLEVENT_IMPL_read_byte());
+	LLEVENT_IMPL_end_read_extended_data();
+	check_simple_events(SIMPLE_EVENT_TYPE, 7, 1);
+}
+
+/**
+ * Offers batches of events: queued in order, all or none of them. The invalid batches are rejected, including the
+ * simple events of a coalesced type.
+ */
+static void test_batches(void) {
+	LLEVENT_batch_event_t batch[3] = {
+		{ SIMPLE_EVENT_TYPE, 1, NULL },
+		{ EXTENDED_EVENT_TYPE, 17, offered_data },
+		{ SIMPLE_EVENT_TYPE, 2, NULL },
+	};
+	TEST_ASSERT_EQUAL_INT(ERR_WRONG_ARGS, LLEVENT_offerEvents(batch, 0));
+	TEST_ASSERT_EQUAL_INT(ERR_WRONG_ARGS, LLEVENT_offerEvents(batch, LLEVENT_BATCH_MAX_EVENTS + 1));
+	TEST_ASSERT_EQUAL_INT(ERR_WRONG_ARGS, LLEVENT_offerEvents(NULL, 1));
+
+	TEST_ASSERT_EQUAL_INT(NO_ERR, LLEVENT_offerEvents(batch, 3));
+	check_simple_events(SIMPLE_EVENT_TYPE, 1, 1);
+	check_extended_event(EXTENDED_EVENT_TYPE, offered_data, 17);
+	check_simple_events(SIMPLE_EVENT_TYPE, 2, 1);
+
+	// A batch that does not fit is not queued at all.
+	uint32_t count = fill_queue(SIMPLE_EVENT_TYPE);
+	TEST_ASSERT(count > 0u);
+	TEST_ASSERT_EQUAL_INT(ERR_FIFO_FULL, LLEVENT_offerEvents(batch, 3));
+	check_simple_events(SIMPLE_EVENT_TYPE, 0, count);
+	check_no_event();
+
+#if EVENT_COALESCING_SUPPORT == 1
+	// The extended events of a coalesced type are accepted, they are never coalesced.
+	LLEVENT_batch_event_t extended_batch[1] = { { SIMPLE_EVENT_TYPE, 6, offered_data } };
+	TEST_ASSERT_EQUAL_INT(NO_ERR, LLEVENT_setTypeCoalescing(SIMPLE_EVENT_TYPE, true));
+	TEST_ASSERT_EQUAL_INT(ERR_WRONG_ARGS, LLEVENT_offerEvents(batch, 3));
+	TEST_ASSERT_EQUAL_INT(NO_ERR, LLEVENT_offerEvents(extended_batch, 1));
+	TEST_ASSERT_EQUAL_INT(NO_ERR, LLEVENT_setTypeCoalescing(SIMPLE_EVENT_TYPE, false));
+	check_extended_event(SIMPLE_EVENT_TYPE, offered_data, 6);
+#endif // EVENT_COALESCING_SUPPORT == 1
+}
+
+/**
+ * Waits for events with a timeout: the wait returns the available events at once, returns 0 once the timeout
+ * expires, and returns the events offered while the Java thread is suspended.
+ */
+static void test_timed_waits(void) {
+	TEST_ASSERT_EQUAL_INT(NO_ERR, LLEVENT_offerEvent(SIMPLE_EVENT_TYPE, 3));
+	TEST_ASSERT_EQUAL_INT(1, LLEVENT_IMPL_wait_events_with_timeout(taken_events, 10));
+	TEST_ASSERT(!SNI_STUB_is_suspended());
+	TEST_ASSERT_EQUAL_INT(LLEVENT_FRAMING_simple_event(SIMPLE_EVENT_TYPE, 3), taken_events[0]);
+
+	ULONG start = tx_time_get();
+	TEST_ASSERT_EQUAL_INT(0, LLEVENT_IMPL_wait_events_with_timeout(taken_events, 2));
+	TEST_ASSERT(SNI_STUB_is_suspended());
+	TEST_ASSERT_EQUAL_INT(0, SNI_STUB_resume_events(taken_events, 2));
+	TEST_ASSERT(!SNI_STUB_is_suspended());
+	TEST_ASSERT((tx_time_get() - start) >= 1u);
+
+	// The event offered while the Java thread is suspended resumes it before the timeout.
+	TEST_ASSERT_EQUAL_INT(0, LLEVENT_IMPL_wait_events_with_timeout(taken_events, 10000));
+	TEST_ASSERT(SNI_STUB_is_suspended());
+	TEST_ASSERT_EQUAL_INT(NO_ERR, LLEVENT_offerEvent(SIMPLE_EVENT_TYPE, 4));
+	TEST_ASSERT_EQUAL_INT(1, SNI_STUB_resume_events(taken_events, 10000));
+	TEST_ASSERT_EQUAL_INT(LLEVENT_FRAMING_simple_event(SIMPLE_EVENT_TYPE, 4), taken_events[0]);
+}
+
+#if EVENT_BLOCKING_OFFER_SUPPORT == 1
+
+/**
+ * Offers events with a timeout while the queue is full: they are rejected once the timeout expires, and queued at once
+ * when there is space.
+ */
+static void test_blocking_offers(void) {
+	TEST_ASSERT_EQUAL_INT(ERR_WRONG_ARGS, LLEVENT_offerEventWithTimeout(-1, 0, 2));
+	uint32_t count = fill_queue(SIMPLE_EVENT_TYPE);
+	TEST_ASSERT(count > 0u);
+	ULONG start = tx_time_get();
+	TEST_ASSERT_EQUAL_INT(ERR_FIFO_FULL, LLEVENT_offerEventWithTimeout(SIMPLE_EVENT_TYPE, 0, 2));
+	TEST_ASSERT_EQUAL_INT(ERR_FIFO_FULL,
+	                      LLEVENT_offerExtendedEventWithTimeout(EXTENDED_EVENT_TYPE, offered_data, 5, 2));
+	TEST_ASSERT((tx_time_get() - start) >= 2u);
+	check_simple_events(SIMPLE_EVENT_TYPE, 0, count);
+
+	TEST_ASSERT_EQUAL_INT(NO_ERR, LLEVENT_offerEventWithTimeout(SIMPLE_EVENT_TYPE, 5, 2));
+	TEST_ASSERT_EQUAL_INT(NO_ERR, LLEVENT_offerExtendedEventWithTimeout(EXTENDED_EVENT_TYPE, offered_data, 5, 2));
+	check_simple_events(SIMPLE_EVENT_TYPE, 5, 1);
+	check_extended_event(EXTENDED_EVENT_TYPE, offered_data, 5);
+}
+
+#endif // EVENT_BLOCKING_OFFER_SUPPORT == 1
+
+#if EVENT_COALESCING_SUPPORT == 1
+
+/**
+ * Offers events of a coalesced type: an event still in the queue is replaced by the last one, at its place.
+ */
+static void test_coalescing(void) {
+	TEST_ASSERT_EQUAL_INT(ERR_WRONG_ARGS, LLEVENT_setTypeCoalescing(-1, true));
+	TEST_ASSERT_EQUAL_INT(NO_ERR, LLEVENT_setTypeCoalescing(COALESCED_EVENT_TYPE, true));
+
+	TEST_ASSERT_EQUAL_INT(NO_ERR, LLEVENT_offerEvent(COALESCED_EVENT_TYPE, 1));
+	TEST_ASSERT_EQUAL_INT(NO_ERR, LLEVENT_offerEvent(SIMPLE_EVENT_TYPE, 7));
+	TEST_ASSERT_EQUAL_INT(NO_ERR, LLEVENT_offerEvent(COALESCED_EVENT_TYPE, 2));
+	TEST_ASSERT_EQUAL_INT(NO_ERR, LLEVENT_offerEvent(COALESCED_EVENT_TYPE, 3));
+	check_simple_events(COALESCED_EVENT_TYPE, 3, 1);
+	check_simple_events(SIMPLE_EVENT_TYPE, 7, 1);
+	check_no_event();
+
+	// Once taken, the next event of the type takes a new place.
+	TEST_ASSERT_EQUAL_INT(NO_ERR, LLEVENT_offerEvent(COALESCED_EVENT_TYPE, 4));
+	TEST_ASSERT_EQUAL_INT(NO_ERR, LLEVENT_offerEvent(SIMPLE_EVENT_TYPE, 8));
+	TEST_ASSERT_EQUAL_INT(NO_ERR, LLEVENT_offerEvent(COALESCED_EVENT_TYPE, 5));
+	check_simple_events(COALESCED_EVENT_TYPE, 5, 1);
+	check_simple_events(SIMPLE_EVENT_TYPE, 8, 1);
+
+	// The extended events are never coalesced.
+	TEST_ASSERT_EQUAL_INT(NO_ERR, LLEVENT_offerExtendedEvent(COALESCED_EVENT_TYPE, offered_data, 4));
+	TEST_ASSERT_EQUAL_INT(NO_ERR, LLEVENT_offerExtendedEvent(COALESCED_EVENT_TYPE, offered_data, 8));
+	check_extended_event(COALESCED_EVENT_TYPE, offered_data, 4);
+	check_extended_event(COALESCED_EVENT_TYPE, offered_data, 8);
+
+	TEST_ASSERT_EQUAL_INT(NO_ERR, LLEVENT_setTypeCoalescing(COALESCED_EVENT_TYPE, false));
+	TEST_ASSERT_EQUAL_INT(NO_ERR, LLEVENT_offerEvent(COALESCED_EVENT_TYPE, 6));
+	TEST_ASSERT_EQUAL_INT(NO_ERR, LLEVENT_offerEvent(COALESCED_EVENT_TYPE, 7));
+	check_simple_events(COALESCED_EVENT_TYPE, 6, 2);
+}
+
+/**
+ * Offers events of a coalesced type from several producer threads. While the queue is full, each event is rejected:
+ * an event accepted because it was coalesced with an event that did not fit in the queue would be lost. While the Java
+ * thread takes the events, the events of each producer are taken in order, and the last event taken is the last event
+ * accepted from one of the producers.
+ */
+static void test_concurrent_coalescing(void) {
+	TEST_ASSERT_EQUAL_INT(NO_ERR, LLEVENT_setTypeCoalescing(COALESCED_EVENT_TYPE, true));
+
+	uint32_t count = fill_queue(SIMPLE_EVENT_TYPE);
+	start_producers();
+	for (uint32_t p = 0; p < (uint32_t)PRODUCER_COUNT; p++) {
+		TEST_ASSERT_EQUAL_INT(TX_SUCCESS, tx_semaphore_get(&producers_done_semaphore, TX_WAIT_FOREVER));
+	}
+	delete_producers();
+	for (uint32_t p = 0; p < (uint32_t)PRODUCER_COUNT; p++) {
+		TEST_ASSERT_EQUAL_INT(NO_ACCEPTED_DATA, last_accepted_data[p]);
+	}
+	check_simple_events(SIMPLE_EVENT_TYPE, 0, count);
+	check_no_event();
+
+	uint32_t last_taken_data[PRODUCER_COUNT];
+	for (uint32_t p = 0; p < (uint32_t)PRODUCER_COUNT; p++) {
+		last_taken_data[p] = NO_ACCEPTED_DATA;
+	}
+	uint32_t last_data = NO_ACCEPTED_DATA;
+	uint32_t done_producers = 0;
+	bool taken = true;
+	start_producers();
+	// Take the events until the producers are done and the queue is drained.
+	while ((done_producers < (uint32_t)PRODUCER_COUNT) || taken) {
+		if (tx_semaphore_get(&producers_done_semaphore, TX_NO_WAIT) == TX_SUCCESS) {
+			done_producers++;
+		}
+		uint32_t event;
+		taken = take_event(&event);
+		if (taken) {
+			uint32_t data = event & LLEVENT_FRAMING_DATA_MASK;
+			uint32_t producer = data >> PRODUCER_DATA_SHIFT;
+			TEST_ASSERT_EQUAL_INT(LLEVENT_FRAMING_simple_event(COALESCED_EVENT_TYPE, data), event);
+			TEST_ASSERT(producer < (uint32_t)PRODUCER_COUNT);
+			TEST_ASSERT((NO_ACCEPTED_DATA == last_taken_data[producer]) ||
+			            ((data & PRODUCER_OFFER_MASK) > (last_taken_data[producer] & PRODUCER_OFFER_MASK)));
+			last_taken_data[producer] = data;
+			last_data = data;
+		}
+	}
+	delete_producers();
+	bool last_accepted = false;
+	for (uint32_t p = 0; p < (uint32_t)PRODUCER_COUNT; p++) {
+		last_accepted = last_accepted || (last_accepted_data[p] == last_data);
+	}
+	TEST_ASSERT(last_accepted);
+
+	TEST_ASSERT_EQUAL_INT(NO_ERR, LLEVENT_setTypeCoalescing(COALESCED_EVENT_TYPE, false));
+}
+
+#endif // EVENT_COALESCING_SUPPORT == 1
+
+#if EVENT_TYPE_FILTER_SUPPORT == 1
+
+/**
+ * Offers events of a disabled type: they are discarded with a success, the events already queued are dispatched.
+ */
+static void test_filtering(void) {
+	TEST_ASSERT_EQUAL_INT(ERR_WRONG_ARGS, LLEVENT_setTypeEnabled((int32_t)LLEVENT_FRAMING_MAX_TYPE_ID, false));
+	TEST_ASSERT_EQUAL_INT(NO_ERR, LLEVENT_offerEvent(FILTERED_EVENT_TYPE, 1));
+	TEST_ASSERT_EQUAL_INT(NO_ERR, LLEVENT_setTypeEnabled(FILTERED_EVENT_TYPE, false));
+
+	TEST_ASSERT_EQUAL_INT(NO_ERR, LLEVENT_offerEvent(FILTERED_EVENT_TYPE, 2));
+	TEST_ASSERT_EQUAL_INT(NO_ERR, LLEVENT_offerExtendedEvent(FILTERED_EVENT_TYPE, offered_data, 8));
+	TEST_ASSERT_EQUAL_INT(NO_ERR, LLEVENT_offerEvent(SIMPLE_EVENT_TYPE, 3));
+	check_simple_events(FILTERED_EVENT_TYPE, 1, 1);
+	check_simple_events(SIMPLE_EVENT_TYPE, 3, 1);
+	check_no_event();
+
+	TEST_ASSERT_EQUAL_INT(NO_ERR, LLEVENT_setTypeEnabled(FILTERED_EVENT_TYPE, true));
+	TEST_ASSERT_EQUAL_INT(NO_ERR, LLEVENT_offerEvent(FILTERED_EVENT_TYPE, 4));
+	check_simple_events(FILTERED_EVENT_TYPE, 4, 1);
+}
+
+#endif // EVENT_TYPE_FILTER_SUPPORT == 1
+
+#if EVENT_OVERFLOW_POLICY_SUPPORT == 1
+
+#if EVENT_MAPPED_DATA_SUPPORT == 1
+
+// Number of calls to release_mapped_data().
+static uint32_t released_mapped_data;
+
+/**
+ * Release function of the mapped extended events: counts the calls, the data is the data of the extended events.
+ */
+static void release_mapped_data(const void* data, void* arg) {
+	if ((data == (const void*)offered_data) && (arg == (void*)offered_data)) {
+		released_mapped_data++;
+	}
+}
+
+#endif // EVENT_MAPPED_DATA_SUPPORT == 1
+
+/**
+ * Offers events while the queue is full with each overflow policy: rejected and counted, spilled and dispatched in
+ * order once the queue is drained, or taking the place of the oldest events.
+ */
+static void test_overflow_policies(void) {
+	TEST_ASSERT_EQUAL_INT(ERR_WRONG_ARGS, LLEVENT_setTypeOverflowPolicy(SPILLED_EVENT_TYPE, 3));
+	jint dropped_events = LLEVENT_IMPL_get_type_dropped_events(SIMPLE_EVENT_TYPE);
+
+	// Rejected: the event offered while the queue is full is counted.
+	uint32_t count = fill_queue(SIMPLE_EVENT_TYPE);
+	TEST_ASSERT(count > 0u);
+	TEST_ASSERT_EQUAL_INT(ERR_FIFO_FULL, LLEVENT_offerEvent(SIMPLE_EVENT_TYPE, 0));
+	TEST_ASSERT_EQUAL_INT(dropped_events + 2, LLEVENT_IMPL_get_type_dropped_events(SIMPLE_EVENT_TYPE));
+
+	// Spilled: dispatched once the queue is drained, after the events of the queue.
+	TEST_ASSERT_EQUAL_INT(NO_ERR, LLEVENT_setTypeOverflowPolicy(SPILLED_EVENT_TYPE, LLEVENT_OVERFLOW_SPILL));
+	for (uint32_t i = 0; i < 10u; i++) {
+		TEST_ASSERT_EQUAL_INT(NO_ERR, LLEVENT_offerEvent(SPILLED_EVENT_TYPE, (int32_t)i));
+	}
+	TEST_ASSERT_EQUAL_INT(NO_ERR, LLEVENT_offerExtendedEvent(SPILLED_EVENT_TYPE, offered_data, 9));
+	check_simple_events(SIMPLE_EVENT_TYPE, 0, count);
+	check_simple_events(SPILLED_EVENT_TYPE, 0, 10);
+	check_extended_event(SPILLED_EVENT_TYPE, offered_data, 9);
+	TEST_ASSERT_EQUAL_INT(0, LLEVENT_IMPL_get_type_dropped_events(SPILLED_EVENT_TYPE));
+	check_no_event();
+
+#if (EVENT_BLOCKING_OFFER_SUPPORT == 1) || (EVENT_MAPPED_DATA_SUPPORT == 1)
+	// The offers with a timeout and the mapped extended events are spilled too while the ring holds events, even if
+	// their queue has space.
+	count = fill_queue(SIMPLE_EVENT_TYPE);
+	TEST_ASSERT_EQUAL_INT(NO_ERR, LLEVENT_offerEvent(SPILLED_EVENT_TYPE, 0));
+	check_simple_events(SIMPLE_EVENT_TYPE, 0, 1);
+#if EVENT_BLOCKING_OFFER_SUPPORT == 1
+	TEST_ASSERT_EQUAL_INT(NO_ERR, LLEVENT_offerEventWithTimeout(SPILLED_EVENT_TYPE, 1, 2));
+	TEST_ASSERT_EQUAL_INT(NO_ERR, LLEVENT_offerExtendedEventWithTimeout(SPILLED_EVENT_TYPE, offered_data, 7, 2));
+#endif // EVENT_BLOCKING_OFFER_SUPPORT == 1
+#if EVENT_MAPPED_DATA_SUPPORT == 1
+	// The data of the mapped event is copied, it is given back at once.
+	released_mapped_data = 0;
+	TEST_ASSERT_EQUAL_INT(NO_ERR, LLEVENT_offerMappedExtendedEvent(SPILLED_EVENT_TYPE, offered_data, 11,
+	                                                               release_mapped_data, offered_data));
+	TEST_ASSERT_EQUAL_INT(1, released_mapped_data);
+#endif // EVENT_MAPPED_DATA_SUPPORT == 1
+	check_simple_events(SIMPLE_EVENT_TYPE, 1, count - 1u);
+	check_simple_events(SPILLED_EVENT_TYPE, 0, 1);
+#if EVENT_BLOCKING_OFFER_SUPPORT == 1
+	check_simple_events(SPILLED_EVENT_TYPE, 1, 1);
+	check_extended_event(SPILLED_EVENT_TYPE, offered_data, 7);
+#endif // EVENT_BLOCKING_OFFER_SUPPORT == 1
+#if EVENT_MAPPED_DATA_SUPPORT == 1
+	check_extended_event(SPILLED_EVENT_TYPE, offered_data, 11);
+#endif // EVENT_MAPPED_DATA_SUPPORT == 1
+	TEST_ASSERT_EQUAL_INT(0, LLEVENT_IMPL_get_type_dropped_events(SPILLED_EVENT_TYPE));
+	check_no_event();
+#endif // (EVENT_BLOCKING_OFFER_SUPPORT == 1) || (EVENT_MAPPED_DATA_SUPPORT == 1)
+
+	// Dropping the oldest: the newest events are dispatched.
+	TEST_ASSERT_EQUAL_INT(NO_ERR, LLEVENT_setTypeOverflowPolicy(DROPPED_EVENT_TYPE, LLEVENT_OVERFLOW_DROP_OLDEST));
+	for (uint32_t i = 0; i < (count + 5u); i++) {
+		TEST_ASSERT_EQUAL_INT(NO_ERR, LLEVENT_offerEvent(DROPPED_EVENT_TYPE, (int32_t)i));
+	}
+	check_simple_events(DROPPED_EVENT_TYPE, 5, count);
+	TEST_ASSERT_EQUAL_INT(5, LLEVENT_IMPL_get_type_dropped_events(DROPPED_EVENT_TYPE));
+
+	// Once the overflow ring is full too, its oldest events are dropped: the newest events it holds are dispatched
+	// last, after the newest events of the queue if the queue holds more events than the ring.
+	uint32_t burst = count + (uint32_t)LLEVENT_AMP_RING_WORDS;
+	for (uint32_t i = 0; i < burst; i++) {
+		TEST_ASSERT_EQUAL_INT(NO_ERR, LLEVENT_offerEvent(DROPPED_EVENT_TYPE, (int32_t)i));
+	}
+	uint32_t spilled = (count < RING_SIMPLE_EVENTS) ? count : RING_SIMPLE_EVENTS;
+	check_simple_events(DROPPED_EVENT_TYPE, spilled, count - spilled);
+	check_simple_events(DROPPED_EVENT_TYPE, burst - spilled, spilled);
+	TEST_ASSERT_EQUAL_INT(5u + burst - count, LLEVENT_IMPL_get_type_dropped_events(DROPPED_EVENT_TYPE));
+
+	TEST_ASSERT_EQUAL_INT(NO_ERR, LLEVENT_setTypeOverflowPolicy(SPILLED_EVENT_TYPE, LLEVENT_OVERFLOW_REJECT));
+	TEST_ASSERT_EQUAL_INT(NO_ERR, LLEVENT_setTypeOverflowPolicy(DROPPED_EVENT_TYPE, LLEVENT_OVERFLOW_REJECT));
+}
+
+#endif // EVENT_OVERFLOW_POLICY_SUPPORT == 1
+
+#if EVENT_DELTA_TYPE_COUNT > 0
+
+/**
+ * Offers extended events of a delta-encoded type: a first event, events changing a few bytes, an unchanged event and
+ * an event of another length. The Java thread reads the data as offered.
+ */
+static void test_delta_encoding(void) {
+	static uint8_t frames[4][DATA_LENGTH];
+	TEST_ASSERT_EQUAL_INT(ERR_WRONG_ARGS, LLEVENT_setTypeDeltaEncoding(-1, true));
+	TEST_ASSERT_EQUAL_INT(NO_ERR, LLEVENT_setTypeDeltaEncoding(DELTA_EVENT_TYPE, true));
+
+	(void)memcpy(frames[0], offered_data, DATA_LENGTH);
+	(void)memcpy(frames[1], frames[0], DATA_LENGTH);
+	frames[1][3] ^= 0x5Au;
+	frames[1][40] ^= 0xA5u;
+	frames[1][41] ^= 0xA5u;
+	(void)memcpy(frames[2], frames[1], DATA_LENGTH);
+	(void)memcpy(frames[3], frames[1], DATA_LENGTH);
+	frames[3][DATA_LENGTH - 1] ^= 0xFFu;
+
+	for (uint32_t i = 0; i < 4u; i++) {
+		TEST_ASSERT_EQUAL_INT(NO_ERR,
+		                      LLEVENT_offerExtendedEvent(DELTA_EVENT_TYPE, frames[i], DATA_LENGTH - (i / 3u)));
+	}
+	for (uint32_t i = 0; i < 4u; i++) {
+		check_extended_event(DELTA_EVENT_TYPE, frames[i], DATA_LENGTH - (i / 3u));
+	}
+
+#if EVENT_QUEUE_COUNT > 1
+	// The priority of the type changes while its events are queued: the delta event is read before its reference and
+	// has no data available.
+	TEST_ASSERT_EQUAL_INT(NO_ERR, LLEVENT_offerExtendedEvent(DELTA_EVENT_TYPE, frames[0], DATA_LENGTH));
+	TEST_ASSERT_EQUAL_INT(NO_ERR, LLEVENT_setTypePriority(DELTA_EVENT_TYPE, 1));
+	TEST_ASSERT_EQUAL_INT(NO_ERR, LLEVENT_offerExtendedEvent(DELTA_EVENT_TYPE, frames[1], DATA_LENGTH));
+	TEST_ASSERT_EQUAL_INT(NO_ERR, LLEVENT_setTypePriority(DELTA_EVENT_TYPE, 0));
+#if EVENT_CONSUMER_COUNT > 1
+	TEST_ASSERT_EQUAL_INT(1, LLEVENT_IMPL_wait_consumer_events_with_timeout(queue_consumers[1], taken_events, -1));
+#else
+	TEST_ASSERT_EQUAL_INT(1, LLEVENT_IMPL_wait_events_with_timeout(taken_events, -1));
+#endif // EVENT_CONSUMER_COUNT > 1
+	TEST_ASSERT_EQUAL_INT(LLEVENT_FRAMING_extended_event(DELTA_EVENT_TYPE, DATA_LENGTH), (uint32_t)taken_events[0]);
+	LLEVENT_IMPL_start_read_extended_data(DATA_LENGTH);
+	TEST_ASSERT_EQUAL_INT(0, LLEVENT_IMPL_available());
+	TEST_ASSERT(!SNI_STUB_take_exception());
+	(void)LLEVENT_IMPL_read_int();
+	TEST_ASSERT(SNI_STUB_take_exception());
+	LLEVENT_IMPL_end_read_extended_data();
+	// The reference is read as offered.
+	check_extended_event(DELTA_EVENT_TYPE, frames[0], DATA_LENGTH);
+#endif // EVENT_QUEUE_COUNT > 1
+
+	TEST_ASSERT_EQUAL_INT(NO_ERR, LLEVENT_setTypeDeltaEncoding(DELTA_EVENT_TYPE, false));
+}
+
+#endif // EVENT_DELTA_TYPE_COUNT > 0
+
+#if EVENT_CONSUMER_COUNT > 1
+
+/**
+ * Offers an event to a queue of each consumer: each consumer takes the events of its own queues only.
+ */
+static void test_consumers(void) {
+	for (uint32_t c = 0; c < (uint32_t)EVENT_CONSUMER_COUNT; c++) {
+		// The highest priority dispatched by the consumer.
+		for (uint32_t p = 0; p < (uint32_t)EVENT_QUEUE_COUNT; p++) {
+			if (queue_consumers[p] == c) {
+				TEST_ASSERT_EQUAL_INT(NO_ERR, LLEVENT_setTypePriority((int32_t)(CONSUMER_EVENT_TYPE + c), (int32_t)p));
+			}
+		}
+		TEST_ASSERT_EQUAL_INT(NO_ERR, LLEVENT_offerEvent((int32_t)(CONSUMER_EVENT_TYPE + c), (int32_t)c));
+	}
+
+	for (uint32_t c = (uint32_t)EVENT_CONSUMER_COUNT; c > 0u; c--) {
+		jint consumer = (jint)c - 1;
+		TEST_ASSERT_EQUAL_INT(1, LLEVENT_IMPL_wait_consumer_events_with_timeout(consumer, taken_events, -1));
+		TEST_ASSERT_EQUAL_INT(LLEVENT_FRAMING_simple_event(CONSUMER_EVENT_TYPE + c - 1u, c - 1u), taken_events[0]);
+		TEST_ASSERT_EQUAL_INT(0, LLEVENT_IMPL_wait_consumer_events_with_timeout(consumer, taken_events, -1));
+	}
+	TEST_ASSERT_EQUAL_INT(0, LLEVENT_IMPL_wait_consumer_events_with_timeout(EVENT_CONSUMER_COUNT, taken_events, -1));
+	TEST_ASSERT(SNI_STUB_take_exception());
+
+	// The Java thread reads the extended event with the reader of the consumer it waited on last.
+	TEST_ASSERT_EQUAL_INT(NO_ERR, LLEVENT_offerExtendedEvent(CONSUMER_EVENT_TYPE, offered_data, 9));
+	TEST_ASSERT_EQUAL_INT(0,
+	                      LLEVENT_IMPL_wait_consumer_events_with_timeout(EVENT_CONSUMER_COUNT - 1, taken_events, -1));
+	check_extended_event(CONSUMER_EVENT_TYPE, offered_data, 9);
+
+	for (uint32_t c = 0; c < (uint32_t)EVENT_CONSUMER_COUNT; c++) {
+		TEST_ASSERT_EQUAL_INT(NO_ERR, LLEVENT_setTypePriority((int32_t)(CONSUMER_EVENT_TYPE + c), 0));
+	}
+}
+
+#endif // EVENT_CONSUMER_COUNT > 1
+
+#if EVENT_PRODUCER_LANE_COUNT > 0
+
+/**
+ * Registers the producer lanes until they are all registered, offers events to them and checks the order of the events
+ * moved into the queue. The events offered while the queue is full stay in their lane, which rejects the events
+ * offered once it is full.
+ */
+static void test_producer_lanes(void) {
+	for (int32_t i = 0; i < (int32_t)EVENT_PRODUCER_LANE_COUNT; i++) {
+		TEST_ASSERT_EQUAL_INT(i, LLEVENT_registerProducerLane());
+	}
+	TEST_ASSERT_EQUAL_INT(ERR_FIFO_FULL, LLEVENT_registerProducerLane());
+	TEST_ASSERT_EQUAL_INT(ERR_WRONG_ARGS, LLEVENT_offerLaneEvent(-1, SIMPLE_EVENT_TYPE, 0));
+	TEST_ASSERT_EQUAL_INT(ERR_WRONG_ARGS, LLEVENT_offerLaneEvent(EVENT_PRODUCER_LANE_COUNT, SIMPLE_EVENT_TYPE, 0));
+	TEST_ASSERT_EQUAL_INT(ERR_WRONG_ARGS, LLEVENT_offerLaneExtendedEvent(0, EXTENDED_EVENT_TYPE, NULL, 1));
+
+	// The order of the events of a lane is kept.
+	TEST_ASSERT_EQUAL_INT(NO_ERR, LLEVENT_offerLaneEvent(0, SIMPLE_EVENT_TYPE, 0));
+	TEST_ASSERT_EQUAL_INT(NO_ERR, LLEVENT_offerLaneExtendedEvent(0, EXTENDED_EVENT_TYPE, offered_data, 13));
+	TEST_ASSERT_EQUAL_INT(NO_ERR, LLEVENT_offerLaneEvent(0, SIMPLE_EVENT_TYPE, 1));
+	check_simple_events(SIMPLE_EVENT_TYPE, 0, 1);
+	check_extended_event(EXTENDED_EVENT_TYPE, offered_data, 13);
+	check_simple_events(SIMPLE_EVENT_TYPE, 1, 1);
+
+#if EVENT_PRODUCER_LANE_COUNT > 1
+	// The events of 2 lanes are merged one event of each lane in turn, starting from either lane.
+	for (uint32_t i = 0; i < 2u; i++) {
+		TEST_ASSERT_EQUAL_INT(NO_ERR, LLEVENT_offerLaneEvent(0, SIMPLE_EVENT_TYPE, (int32_t)i));
+		TEST_ASSERT_EQUAL_INT(NO_ERR, LLEVENT_offerLaneEvent(1, SIMPLE_EVENT_TYPE, (int32_t)(0x100u + i)));
+	}
+	uint32_t event;
+	TEST_ASSERT(take_event(&event));
+	uint32_t first_data = (LLEVENT_FRAMING_simple_event(SIMPLE_EVENT_TYPE, 0) == event) ? 0u : 0x100u;
+	TEST_ASSERT_EQUAL_INT(LLEVENT_FRAMING_simple_event(SIMPLE_EVENT_TYPE, first_data), event);
+	check_simple_events(SIMPLE_EVENT_TYPE, first_data ^ 0x100u, 1);
+	check_simple_events(SIMPLE_EVENT_TYPE, first_data + 1u, 1);
+	check_simple_events(SIMPLE_EVENT_TYPE, (first_data ^ 0x100u) + 1u, 1);
+#endif // EVENT_PRODUCER_LANE_COUNT > 1
+
+	// The event offered to a lane while the Java thread is suspended resumes it.
+	TEST_ASSERT_EQUAL_INT(0, LLEVENT_IMPL_wait_events_with_timeout(taken_events, 10000));
+	TEST_ASSERT(SNI_STUB_is_suspended());
+	TEST_ASSERT_EQUAL_INT(NO_ERR, LLEVENT_offerLaneEvent(EVENT_PRODUCER_LANE_COUNT - 1, SIMPLE_EVENT_TYPE, 2));
+	TEST_ASSERT_EQUAL_INT(1, SNI_STUB_resume_events(taken_events, 10000));
+	TEST_ASSERT_EQUAL_INT(LLEVENT_FRAMING_simple_event(SIMPLE_EVENT_TYPE, 2), taken_events[0]);
+
+	// The events of the lane wait for space in the full queue, the lane rejects the events once it is full.
+	uint32_t count = fill_queue(SIMPLE_EVENT_TYPE);
+	uint32_t lane_count = 0;
+	while ((lane_count < (uint32_t)MAX_EVENTS) &&
+	       (LLEVENT_offerLaneEvent(0, SIMPLE_EVENT_TYPE, (int32_t)(count + lane_count)) == NO_ERR)) {
+		lane_count++;
+	}
+	TEST_ASSERT_EQUAL_INT(RING_SIMPLE_EVENTS, lane_count);
+#if EVENT_OVERFLOW_POLICY_SUPPORT == 1
+	// The events rejected by the full lane are counted as dropped.
+	jint dropped_events = LLEVENT_IMPL_get_type_dropped_events(SIMPLE_EVENT_TYPE);
+	TEST_ASSERT_EQUAL_INT(ERR_FIFO_FULL, LLEVENT_offerLaneEvent(0, SIMPLE_EVENT_TYPE, 0));
+	TEST_ASSERT_EQUAL_INT(dropped_events + 1, LLEVENT_IMPL_get_type_dropped_events(SIMPLE_EVENT_TYPE));
+#endif // EVENT_OVERFLOW_POLICY_SUPPORT == 1
+	check_simple_events(SIMPLE_EVENT_TYPE, 0, count + lane_count);
+}
+
+#endif // EVENT_PRODUCER_LANE_COUNT > 0
+
+#if EVENT_REPLAY_LOG_SUPPORT == 1
+
+/**
+ * Offers simple events with the data 0, 1, 2... and takes each of them, so that they are recorded into the replay log
+ * without filling the queue.
+ *
+ * @param count the number of events.
+ */
+static void offer_recorded_events(uint32_t count) {
+	for (uint32_t i = 0; i < count; i++) {
+		TEST_ASSERT_EQUAL_INT(NO_ERR, LLEVENT_offerEvent(SIMPLE_EVENT_TYPE, (int32_t)i));
+		check_simple_events(SIMPLE_EVENT_TYPE, i, 1);
+	}
+}
+
+/**
+ * Checks that the captured replay log holds the records of simple events with the data 0, 1, 2...
+ *
+ * @param count the number of records.
+ */
+static void check_recorded_events(uint32_t count) {
+	TEST_ASSERT_EQUAL_INT(count * SIMPLE_RECORD_LENGTH, captured_log_length);
+	for (uint32_t i = 0; i < count; i++) {
+		uint32_t event_message;
+		(void)memcpy(&event_message, &captured_log[i * SIMPLE_RECORD_LENGTH], sizeof(event_message));
+		TEST_ASSERT_EQUAL_INT(LLEVENT_FRAMING_simple_event(SIMPLE_EVENT_TYPE, i), event_message);
+	}
+}
+
+/**
+ * Records events into the replay log, flushes it and replays the captured log: the events are offered again in their
+ * order. The records that wrap around the end of the ring are flushed in order, the events recorded while the ring is
+ * full are dropped, and the replay of a truncated log stops at its incomplete record.
+ */
+static void test_replay_log(void) {
+	// The events of the previous tests are flushed.
+	(void)LLEVENT_REPLAY_flush();
+	captured_log_length = 0;
+	TEST_ASSERT_EQUAL_INT(0, LLEVENT_REPLAY_flush());
+	TEST_ASSERT_EQUAL_INT(0, captured_log_length);
+
+	TEST_ASSERT_EQUAL_INT(NO_ERR, LLEVENT_offerEvent(SIMPLE_EVENT_TYPE, 0));
+	TEST_ASSERT_EQUAL_INT(NO_ERR, LLEVENT_offerExtendedEvent(EXTENDED_EVENT_TYPE, offered_data, 13));
+	TEST_ASSERT_EQUAL_INT(NO_ERR, LLEVENT_offerEvent(SIMPLE_EVENT_TYPE, 1));
+	check_simple_events(SIMPLE_EVENT_TYPE, 0, 1);
+	check_extended_event(EXTENDED_EVENT_TYPE, offered_data, 13);
+	check_simple_events(SIMPLE_EVENT_TYPE, 1, 1);
+	uint32_t log_length = (3u * SIMPLE_RECORD_LENGTH) + 16u;
+	TEST_ASSERT_EQUAL_INT(log_length, LLEVENT_REPLAY_flush());
+	TEST_ASSERT_EQUAL_INT(log_length, captured_log_length);
+
+	// The replayed events are recorded again.
+	static uint8_t replayed_log[EVENT_REPLAY_LOG_SIZE];
+	(void)memcpy(replayed_log, captured_log, log_length);
+	TEST_ASSERT_EQUAL_INT(3, LLEVENT_REPLAY_replay(replayed_log, log_length, false));
+	check_simple_events(SIMPLE_EVENT_TYPE, 0, 1);
+	check_extended_event(EXTENDED_EVENT_TYPE, offered_data, 13);
+	check_simple_events(SIMPLE_EVENT_TYPE, 1, 1);
+	captured_log_length = 0;
+	TEST_ASSERT_EQUAL_INT(log_length, LLEVENT_REPLAY_flush());
+	TEST_ASSERT_EQUAL_INT(log_length, captured_log_length);
+	// Only the timestamps of the records differ.
+	TEST_ASSERT(memcmp(&replayed_log[0], &captured_log[0], 4) == 0);
+	TEST_ASSERT(memcmp(&replayed_log[8], &captured_log[8], 4) == 0);
+	TEST_ASSERT(memcmp(&replayed_log[16], &captured_log[16], 20) == 0);
+
+	// The events before the incomplete record are offered.
+	TEST_ASSERT_EQUAL_INT(-1, LLEVENT_REPLAY_replay(replayed_log, log_length - 4u, false));
+	check_simple_events(SIMPLE_EVENT_TYPE, 0, 1);
+	check_extended_event(EXTENDED_EVENT_TYPE, offered_data, 13);
+	TEST_ASSERT_EQUAL_INT(-1, LLEVENT_REPLAY_replay(replayed_log, SIMPLE_RECORD_LENGTH - 1u, false));
+
+	// Wherever the ring starts, one of 2 batches of records almost filling the ring wraps around its end.
+	for (uint32_t i = 0; i < 2u; i++) {
+		(void)LLEVENT_REPLAY_flush();
+		captured_log_length = 0;
+		offer_recorded_events(RING_SIMPLE_RECORDS);
+		TEST_ASSERT_EQUAL_INT(RING_SIMPLE_RECORDS * SIMPLE_RECORD_LENGTH, LLEVENT_REPLAY_flush());
+		check_recorded_events(RING_SIMPLE_RECORDS);
+	}
+
+	// The event recorded once the ring is full is dropped.
+	uint32_t dropped_events = LLEVENT_REPLAY_get_dropped_events();
+	captured_log_length = 0;
+	offer_recorded_events(RING_SIMPLE_RECORDS + 1u);
+	TEST_ASSERT_EQUAL_INT(dropped_events + 1u, LLEVENT_REPLAY_get_dropped_events());
+	TEST_ASSERT_EQUAL_INT(RING_SIMPLE_RECORDS * SIMPLE_RECORD_LENGTH, LLEVENT_REPLAY_flush());
+	check_recorded_events(RING_SIMPLE_RECORDS);
+}
+
+#endif // EVENT_REPLAY_LOG_SUPPORT == 1
+
+#if EVENT_AMP_BRIDGE_SUPPORT == 1
+
+/**
+ * Moves the write and read indexes of the empty AMP ring to a word offset, by writing and reading simple events.
+ *
+ * @param offset the word offset, a multiple of 2.
+ */
+static void move_amp_ring_to(uint32_t offset) {
+	LLEVENT_amp_event_t event;
+	LLEVENT_AMP_initialize(&amp_ring);
+	for (uint32_t i = 0; i < (offset / 2u); i++) {
+		TEST_ASSERT(LLEVENT_AMP_offer_event(&amp_ring, SIMPLE_EVENT_TYPE, (int32_t)i));
+		TEST_ASSERT(LLEVENT_AMP_peek_event(&amp_ring, &event));
+		LLEVENT_AMP_release_event(&amp_ring, &event);
+	}
+	TEST_ASSERT(!LLEVENT_AMP_peek_event(&amp_ring, &event));
+}
+
+/**
+ * Writes and reads the events of the AMP ring: an event that does not fit at the end of the ring is written at its
+ * start after a padding, the largest extended event always fits in the empty ring, and the corrupted events are
+ * dropped and counted.
+ */
+static void test_amp_ring(void) {
+	LLEVENT_amp_event_t event;
+
+	// A simple event fits in the last 2 words of the ring, an extended event is written after a padding.
+	move_amp_ring_to(LLEVENT_AMP_RING_WORDS - 2u);
+	TEST_ASSERT(LLEVENT_AMP_offer_event(&amp_ring, SIMPLE_EVENT_TYPE, 3));
+	TEST_ASSERT(LLEVENT_AMP_offer_extended_event(&amp_ring, EXTENDED_EVENT_TYPE, offered_data, 7));
+	TEST_ASSERT(LLEVENT_AMP_peek_event(&amp_ring, &event));
+	TEST_ASSERT_EQUAL_INT(SIMPLE_EVENT_TYPE, event.type);
+	TEST_ASSERT(!event.extended);
+	TEST_ASSERT_EQUAL_INT(3, event.data);
+	LLEVENT_AMP_release_event(&amp_ring, &event);
+	TEST_ASSERT(LLEVENT_AMP_peek_event(&amp_ring, &event));
+	TEST_ASSERT_EQUAL_INT(EXTENDED_EVENT_TYPE, event.type);
+	TEST_ASSERT(event.extended);
+	TEST_ASSERT_EQUAL_INT(7, event.data);
+	TEST_ASSERT(event.extended_data == (void*)&amp_ring.words[2]);
+	TEST_ASSERT(memcmp(offered_data, event.extended_data, 7) == 0);
+	LLEVENT_AMP_release_event(&amp_ring, &event);
+	TEST_ASSERT_EQUAL_INT(LLEVENT_AMP_RING_WORDS + 4u, atomic_load(&amp_ring.read_index));
+
+	move_amp_ring_to(LLEVENT_AMP_RING_WORDS - 2u);
+	TEST_ASSERT(LLEVENT_AMP_offer_extended_event(&amp_ring, EXTENDED_EVENT_TYPE, offered_data, 1));
+	TEST_ASSERT_EQUAL_INT(LLEVENT_AMP_PADDING, amp_ring.words[LLEVENT_AMP_RING_WORDS - 2u]);
+	TEST_ASSERT(LLEVENT_AMP_peek_event(&amp_ring, &event));
+	TEST_ASSERT_EQUAL_INT(1, event.data);
+	TEST_ASSERT(event.extended_data == (void*)&amp_ring.words[2]);
+	LLEVENT_AMP_release_event(&amp_ring, &event);
+
+	// The largest extended event fits after any padding, a second one does not fit.
+	move_amp_ring_to((LLEVENT_AMP_RING_WORDS / 2u) + 2u);
+	TEST_ASSERT(!LLEVENT_AMP_offer_extended_event(&amp_ring, EXTENDED_EVENT_TYPE, offered_data,
+	                                              LLEVENT_AMP_MAX_DATA_LENGTH + 1u));
+	TEST_ASSERT(LLEVENT_AMP_offer_extended_event(&amp_ring, EXTENDED_EVENT_TYPE, offered_data,
+	                                             LLEVENT_AMP_MAX_DATA_LENGTH));
+	TEST_ASSERT(!LLEVENT_AMP_offer_extended_event(&amp_ring, EXTENDED_EVENT_TYPE, offered_data,
+	                                              LLEVENT_AMP_MAX_DATA_LENGTH));
+	TEST_ASSERT(LLEVENT_AMP_peek_event(&amp_ring, &event));
+	TEST_ASSERT_EQUAL_INT(LLEVENT_AMP_MAX_DATA_LENGTH, event.data);
+	TEST_ASSERT_EQUAL_INT(LLEVENT_AMP_RING_WORDS / 2u, event.words);
+	TEST_ASSERT(memcmp(offered_data, event.extended_data, LLEVENT_AMP_MAX_DATA_LENGTH) == 0);
+	LLEVENT_AMP_release_event(&amp_ring, &event);
+	TEST_ASSERT(!LLEVENT_AMP_peek_event(&amp_ring, &event));
+	TEST_ASSERT_EQUAL_INT(0, amp_ring.dropped_events);
+
+	// A length exceeding the written words, a too large length and a padding not followed by an event are corrupted:
+	// the events written so far are dropped.
+	move_amp_ring_to(0u);
+	TEST_ASSERT(LLEVENT_AMP_offer_extended_event(&amp_ring, EXTENDED_EVENT_TYPE, offered_data, 4));
+	TEST_ASSERT(LLEVENT_AMP_offer_event(&amp_ring, SIMPLE_EVENT_TYPE, 0));
+	amp_ring.words[1] = 16u;
+	TEST_ASSERT(!LLEVENT_AMP_peek_event(&amp_ring, &event));
+	TEST_ASSERT_EQUAL_INT(1, amp_ring.dropped_events);
+	TEST_ASSERT(!LLEVENT_AMP_peek_event(&amp_ring, &event));
+
+	TEST_ASSERT(LLEVENT_AMP_offer_extended_event(&amp_ring, EXTENDED_EVENT_TYPE, offered_data, 4));
+	amp_ring.words[6] = LLEVENT_AMP_MAX_DATA_LENGTH + 4u;
+	TEST_ASSERT(!LLEVENT_AMP_peek_event(&amp_ring, &event));
+	TEST_ASSERT_EQUAL_INT(2, amp_ring.dropped_events);
+
+	TEST_ASSERT(LLEVENT_AMP_offer_event(&amp_ring, SIMPLE_EVENT_TYPE, 0));
+	amp_ring.words[8] = LLEVENT_AMP_PADDING;
+	TEST_ASSERT(!LLEVENT_AMP_peek_event(&amp_ring, &event));
+	TEST_ASSERT_EQUAL_INT(3, amp_ring.dropped_events);
+	TEST_ASSERT_EQUAL_INT(atomic_load(&amp_ring.write_index), atomic_load(&amp_ring.read_index));
+
+	// The ring is still usable.
+	TEST_ASSERT(LLEVENT_AMP_offer_event(&amp_ring, SIMPLE_EVENT_TYPE, 5));
+	TEST_ASSERT(LLEVENT_AMP_peek_event(&amp_ring, &event));
+	TEST_ASSERT_EQUAL_INT(5, event.data);
+	LLEVENT_AMP_release_event(&amp_ring, &event);
+}
+
+/**
+ * Moves the events of the AMP ring into the event queue with LLEVENT_AMP_doorbell_handler(): the events with invalid
+ * arguments and the events that do not fit in the full queue are dropped and counted.
+ */
+static void test_amp_doorbell_handler(void) {
+	move_amp_ring_to(LLEVENT_AMP_RING_WORDS - 4u);
+	TEST_ASSERT(LLEVENT_AMP_offer_event(&amp_ring, SIMPLE_EVENT_TYPE, 0));
+	TEST_ASSERT(LLEVENT_AMP_offer_extended_event(&amp_ring, EXTENDED_EVENT_TYPE, offered_data,
+	                                             LLEVENT_AMP_MAX_DATA_LENGTH));
+	TEST_ASSERT(LLEVENT_AMP_offer_event(&amp_ring, -1, 0));
+	LLEVENT_AMP_doorbell_handler(&amp_ring);
+	TEST_ASSERT_EQUAL_INT(1, amp_ring.dropped_events);
+	check_simple_events(SIMPLE_EVENT_TYPE, 0, 1);
+	check_extended_event(EXTENDED_EVENT_TYPE, offered_data, LLEVENT_AMP_MAX_DATA_LENGTH);
+	check_no_event();
+
+	// The queued events are kept, the events of the ring are dropped.
+	uint32_t count = fill_queue(SIMPLE_EVENT_TYPE);
+	TEST_ASSERT(LLEVENT_AMP_offer_event(&amp_ring, SIMPLE_EVENT_TYPE, 1));
+	TEST_ASSERT(LLEVENT_AMP_offer_extended_event(&amp_ring, EXTENDED_EVENT_TYPE, offered_data, 9));
+	LLEVENT_AMP_doorbell_handler(&amp_ring);
+	TEST_ASSERT_EQUAL_INT(3, amp_ring.dropped_events);
+	LLEVENT_amp_event_t event;
+	TEST_ASSERT(!LLEVENT_AMP_peek_event(&amp_ring, &event));
+	check_simple_events(SIMPLE_EVENT_TYPE, 0, count);
+}
+
+#endif // EVENT_AMP_BRIDGE_SUPPORT == 1
+
+// -----------------------------------------------------------------------------
+// Public function definition
+// -----------------------------------------------------------------------------
+
+#if EVENT_REPLAY_LOG_SUPPORT == 1
+
+void LLEVENT_FUNCTIONAL_write_log(const void* data, uint32_t length) {
+	if (captured_log_length < (uint32_t)sizeof(captured_log)) {
+		uint32_t free_length = (uint32_t)sizeof(captured_log) - captured_log_length;
+		(void)memcpy(&captured_log[captured_log_length], data, (length < free_length) ? length : free_length);
+	}
+	captured_log_length += length;
+}
+
+#endif // EVENT_REPLAY_LOG_SUPPORT == 1
+
+TestRef LLEVENT_functional_tests(void) {
+	EMB_UNIT_TESTFIXTURES(fixtures) {
+		new_TestFixture("test_events", test_events),
+		new_TestFixture("test_typed_reads", test_typed_reads),
+		new_TestFixture("test_batches", test_batches),
+		new_TestFixture("test_timed_waits", test_timed_waits),
+#if EVENT_BLOCKING_OFFER_SUPPORT == 1
+		new_TestFixture("test_blocking_offers", test_blocking_offers),
+#endif // EVENT_BLOCKING_OFFER_SUPPORT == 1
+#if EVENT_COALESCING_SUPPORT == 1
+		new_TestFixture("test_coalescing", test_coalescing),
+		new_TestFixture("test_concurrent_coalescing", test_concurrent_coalescing),
+#endif // EVENT_COALESCING_SUPPORT == 1
+#if EVENT_TYPE_FILTER_SUPPORT == 1
+		new_TestFixture("test_filtering", test_filtering),
+#endif // EVENT_TYPE_FILTER_SUPPORT == 1
+#if EVENT_OVERFLOW_POLICY_SUPPORT == 1
+		new_TestFixture("test_overflow_policies", test_overflow_policies),
+#endif // EVENT_OVERFLOW_POLICY_SUPPORT == 1
+#if EVENT_DELTA_TYPE_COUNT > 0
+		new_TestFixture("test_delta_encoding", test_delta_encoding),
+#endif // EVENT_DELTA_TYPE_COUNT > 0
+#if EVENT_CONSUMER_COUNT > 1
+		new_TestFixture("test_consumers", test_consumers),
+#endif // EVENT_CONSUMER_COUNT > 1
+#if EVENT_PRODUCER_LANE_COUNT > 0
+		new_TestFixture("test_producer_lanes", test_producer_lanes),
+#endif // EVENT_PRODUCER_LANE_COUNT > 0
+#if EVENT_REPLAY_LOG_SUPPORT == 1
+		new_TestFixture("test_replay_log", test_replay_log),
+#endif // EVENT_REPLAY_LOG_SUPPORT == 1
+#if EVENT_AMP_BRIDGE_SUPPORT == 1
+		new_TestFixture("test_amp_ring", test_amp_ring),
+		new_TestFixture("test_amp_doorbell_handler", test_amp_doorbell_handler),
+#endif // EVENT_AMP_BRIDGE_SUPPORT == 1
+	};
+	EMB_UNIT_TESTCALLER(functional, "LLEVENT_functional", setUp, tearDown, fixtures);
+	return (TestRef)&functional;
+}
+
+#ifdef __cplusplus
+}
+#endif
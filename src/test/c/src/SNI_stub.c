@@ -0,0 +1,178 @@
+/*
+ * C
+ *
+ * Copyright 2026 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/**
+ * @file
+ * @brief SNI functions used by the LLEVENT implementation, stubbed for the test program.
+ * @author MicroEJ Developer Team
+ * @version 1.0.1
+ */
+
+// -----------------------------------------------------------------------------
+// Includes
+// -----------------------------------------------------------------------------
+
+#include "SNI_stub.h"
+#include "LLEVENT_impl.h"
+#include <stdio.h>
+
+#include "tx_api.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// -----------------------------------------------------------------------------
+// Macros and Defines
+// -----------------------------------------------------------------------------
+
+// The ID of the Java thread played by the thread running the tests.
+#define JAVA_THREAD_ID          1
+
+// -----------------------------------------------------------------------------
+// Private global variables
+// -----------------------------------------------------------------------------
+
+// The semaphore given when the Java thread is resumed.
+static TX_SEMAPHORE java_thread_semaphore = { 0 };
+static CHAR* java_thread_semaphore_name = "SNI Stub Java Thread";
+
+// The callback to call when the Java thread is resumed, NULL if it is not suspended.
+static SNI_callback suspend_callback = NULL;
+
+// The timeout of the suspended Java thread, in milliseconds, 0 to wait forever.
+static int64_t suspend_timeout = 0;
+
+static int32_t array_length = 0;
+
+static volatile bool exception_pending = false;
+
+// -----------------------------------------------------------------------------
+// Private function definition
+// -----------------------------------------------------------------------------
+
+/**
+ * Waits until the suspended Java thread is resumed or its timeout expires.
+ *
+ * @return the callback to call, NULL if the Java thread is not suspended.
+ */
+static SNI_callback wait_resume(void) {
+	SNI_callback callback = suspend_callback;
+	if (NULL != callback) {
+		ULONG wait_option = TX_WAIT_FOREVER;
+		if (suspend_timeout > 0) {
+			// At least one tick, as the core engine does not resume a timed out thread before its timeout.
+			int64_t ticks = ((suspend_timeout * (int64_t)TX_TIMER_TICKS_PER_SECOND) + 999) / 1000;
+			wait_option = (ticks < (int64_t)TX_WAIT_FOREVER) ? (ULONG)ticks : (TX_WAIT_FOREVER - 1u);
+		}
+		UINT status = tx_semaphore_get(&java_thread_semaphore, wait_option);
+		if ((TX_SUCCESS != status) && (TX_WAIT_FOREVER == wait_option)) {
+			printf("[SNI Stub] Error, the Java thread is never resumed ; status = 0x%x \n", status);
+		}
+		suspend_callback = NULL;
+	}
+	return callback;
+}
+
+// -----------------------------------------------------------------------------
+// Public function definition
+// -----------------------------------------------------------------------------
+
+void SNI_STUB_initialize(void) {
+	UINT status = tx_semaphore_create(&java_thread_semaphore, java_thread_semaphore_name, 0);
+	if (TX_SUCCESS != status) {
+		printf("[SNI Stub] Error, during tx_semaphore_create ; status = 0x%x \n", status);
+	}
+}
+
+void SNI_STUB_set_array_length(int32_t length) {
+	array_length = length;
+}
+
+bool SNI_STUB_is_suspended(void) {
+	return NULL != suspend_callback;
+}
+
+int32_t SNI_STUB_resume(void) {
+	int32_t result = 0;
+	SNI_callback callback = wait_resume();
+	if (NULL != callback) {
+		// The callbacks given by the LLEVENT implementation return an int32_t or an uint32_t.
+		result = ((int32_t (*)(void))callback)();
+	}
+	return result;
+}
+
+int32_t SNI_STUB_resume_events(jint* events, jlong timeout) {
+	int32_t result = 0;
+	SNI_callback callback = wait_resume();
+	if (NULL != callback) {
+		// The callback of LLEVENT_IMPL_wait_events_with_timeout() takes the arguments of the suspended call.
+		result = ((int32_t (*)(jint*, jlong))callback)(events, timeout);
+	}
+	return result;
+}
+
+uint32_t SNI_STUB_wait_event(void) {
+	uint32_t event = LLEVENT_IMPL_wait_event();
+	while (SNI_STUB_is_suspended()) {
+		event = (uint32_t)SNI_STUB_resume();
+	}
+	return event;
+}
+
+bool SNI_STUB_take_exception(void) {
+	bool exception = exception_pending;
+	exception_pending = false;
+	return exception;
+}
+
+int32_t SNI_getCurrentJavaThreadID(void) {
+	return JAVA_THREAD_ID;
+}
+
+int32_t SNI_suspendCurrentJavaThreadWithCallback(int64_t timeout, SNI_callback callback, void* callback_suspend_arg) {
+	(void)callback_suspend_arg;
+	suspend_callback = callback;
+	suspend_timeout = timeout;
+	return SNI_OK;
+}
+
+int32_t SNI_resumeJavaThread(int32_t java_thread_id) {
+	int32_t result = SNI_ERROR;
+	if (JAVA_THREAD_ID == java_thread_id) {
+		// Unused return value: the semaphore is already set if the Java thread has not run yet.
+		UINT status = tx_semaphore_ceiling_put(&java_thread_semaphore, 1);
+		(void)status;
+		result = SNI_OK;
+	}
+	return result;
+}
+
+int32_t SNI_throwNativeIOException(int32_t error_code, const char* message) {
+	printf("[SNI Stub] IOException %d: %s\n", (int)error_code, message);
+	exception_pending = true;
+	return SNI_OK;
+}
+
+bool SNI_isExceptionPending(void) {
+	return exception_pending;
+}
+
+int32_t SNI_clearPendingException(void) {
+	exception_pending = false;
+	return SNI_OK;
+}
+
+int32_t SNI_getArrayLength(const void* array) {
+	(void)array;
+	return array_length;
+}
+
+#ifdef __cplusplus
+}
+#endif